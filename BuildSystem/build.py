@@ -15,6 +15,7 @@ from Documentation import *
 from Archiver import *
 from rlibrary import *
 from ModelRunner import *
+from Benchmark import *
 from Installer import *
 from DebBuilder import *
 
@@ -44,6 +45,8 @@ def print_usage():
   print '  check - Do a check of the build system'
   print '  rlibrary - Build the R library'
   print '  modelrunner - Run the test suite of models'
+  print '  benchmark - Compare the time per evaluation of the test models'
+  print '              with and without the log statements stripped'
   print '  installer - Build an installer package'
   print '  deb - Create linux .deb installer'
   print '  library - Build shared library for use by front end application'
@@ -57,6 +60,7 @@ def print_usage():
   print '  adolc - Use ADOLC auto-differentiation in compiled executable'
   print '  betadiff - Use BetaDiff auto-differentiation (from CASAL)'
   print '  cppad - Use CppAD auto-differentiation'
+  print '  striplog - Remove the log statements below warning at compile time'
   print ''
   print 'Valid Build parameters: (library only)'
   print '  adolc - Build ADOLC auto-differentiation library'
@@ -215,6 +219,13 @@ def start():
     model_runner = ModelRunner()
     if not model_runner.start():
       return False
+  elif build_target == "benchmark":
+    print "*************************************************************************"
+    print "*************************************************************************"
+    print "--> Starting " + Globals.build_target_ + " Build"
+    benchmark = Benchmark()
+    if not benchmark.start():
+      return False
   elif build_target == "clean":
     print "*************************************************************************"
     print "*************************************************************************"
@@ -0,0 +1,83 @@
+import os
+import sys
+import os.path
+import time
+
+import Globals
+
+EX_OK = getattr(os, "EX_OK", 0)
+
+class Benchmark:
+  """
+  Compare the time per model evaluation of the release binary against
+  the release binary built with the log statements stripped out
+  """
+  repeats_ = 5
+  evaluations_ = 50
+
+  def start(self):
+    binary_name = 'casal2'
+    if Globals.operating_system_ == 'windows':
+      binary_name += '.exe'
+
+    cwd = os.path.normpath(os.getcwd())
+    binaries = {}
+    for flavour in [ 'release', 'release_striplog' ]:
+      binary = cwd + '/bin/' + Globals.operating_system_ + '/' + flavour + '/' + binary_name
+      if not os.path.exists(binary):
+        print 'Looking for ' + binary
+        print 'CASAL2 binary was not found. Can not continue'
+        print 'Please complete a release and a release striplog build before running the benchmark'
+        return False
+      binaries[flavour] = binary
+
+    print ''
+    print 'Model'.ljust(32) + 'release'.rjust(14) + 'striplog'.rjust(14) + 'speedup'.rjust(10)
+    dash_i_dir_list = {"Complex_input","TwoSex_input","SingleSexTagByLength_input"}
+    for folder in sorted(dash_i_dir_list):
+      os.chdir("../TestModels/" + folder)
+      self.write_values_file()
+      seconds = {}
+      for flavour in binaries:
+        seconds[flavour] = self.time_model(binaries[flavour] + ' -r -i benchmark.pars.out -t 1 > benchmark.log 2>&1')
+        if seconds[flavour] < 0:
+          print '[FAILED] - ' + folder + ' with the ' + flavour + ' binary. Please check benchmark.log'
+          os.chdir(cwd)
+          return False
+      os.remove('benchmark.pars.out')
+      os.chdir(cwd)
+
+      release = seconds['release'] / self.evaluations_
+      striplog = seconds['release_striplog'] / self.evaluations_
+      print folder.ljust(32) + (str(round(release * 1000, 3)) + ' ms').rjust(14) + (str(round(striplog * 1000, 3)) + ' ms').rjust(14) + (str(round(release / striplog, 3)) + 'x').rjust(10)
+
+    print ''
+    print 'Times are the fastest of ' + str(self.repeats_) + ' runs of ' + str(self.evaluations_) + ' evaluations divided by the number of evaluations'
+    return True
+
+  """
+  Write the pars.out values repeated so each run has enough evaluations
+  to hide the time taken to load the configuration
+  """
+  def write_values_file(self):
+    lines = open('pars.out').read().splitlines()
+    output = open('benchmark.pars.out', 'w')
+    output.write(lines[0] + '\n')
+    for i in range(self.evaluations_):
+      output.write(lines[1] + '\n')
+    output.close()
+
+  """
+  Run the command repeats_ times and return the fastest time
+  in seconds, or -1 if the command failed
+  """
+  def time_model(self, command):
+    fastest = -1
+    for i in range(self.repeats_):
+      start = time.time()
+      if os.system(command) != EX_OK:
+        return -1
+      elapsed = time.time() - start
+      if fastest < 0 or elapsed < fastest:
+        fastest = elapsed
+    return fastest
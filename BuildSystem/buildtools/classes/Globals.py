@@ -20,9 +20,9 @@ target_special_lig_path_ = ""
 
 allowed_build_targets_ = [ "debug", "release", "documentation", "thirdparty", "thirdpartylean",
                            "test", "archive", "all", "clean", "cleanall", "help",
-                           "check", "modelrunner", "installer", "deb", "library", "frontend" ,"rlibrary"]
+                           "check", "modelrunner", "benchmark", "installer", "deb", "library", "frontend" ,"rlibrary"]
 allowed_build_types_ = [ "debug", "release", "test" ]
-allowed_build_parameters_ = [ "", "adolc", "betadiff", "cppad" ]
+allowed_build_parameters_ = [ "", "adolc", "betadiff", "cppad", "striplog" ]
 allowed_library_parameters_ = [ "release", "test", "adolc", "betadiff", "cppad" ]
 
 def PrintError(error_message):
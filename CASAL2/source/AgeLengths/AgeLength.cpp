@@ -128,12 +128,18 @@ void AgeLength::BuildCV() {
 }
 
 /**
- * Reset the age length class.
+ * Reset the age length class. The CV lookup table is only
+ * rebuilt if one of our estimated parameters has changed
+ * since the last reset.
  */
 void AgeLength::Reset() {
   if (is_estimated_) {
-    LOG_FINEST() << "We are re-building cv lookup table.";
-    BuildCV();
+    if (AddressablesChanged()) {
+      LOG_FINEST() << "We are re-building cv lookup table.";
+      BuildCV();
+      ++cache_rebuilds_;
+    } else
+      ++cache_rebuilds_skipped_;
   }
   DoReset();
 }
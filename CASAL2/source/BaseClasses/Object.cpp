@@ -165,6 +165,23 @@ Double* Object::GetAddressable(const string& label, const string& index) {
   return addressables_[label];
 }
 
+/**
+ * Return the first model year that is affected when the value of an addressable
+ * changes. The model uses this to decide how much of an iteration can be resumed
+ * from a checkpoint instead of being run again.
+ *
+ * The default is 0 which means the addressable could affect the initialisation
+ * phases and the whole model must be run again. Objects that know better (e.g.
+ * year class strengths) override this.
+ *
+ * @param label The label of the addressable
+ * @param index The index of the addressable (e.g. the year), empty if there is none
+ * @return The first year affected by the addressable, 0 if it affects initialisation
+ */
+unsigned Object::GetAddressableFirstYear(const string& label, const string& index) const {
+  return 0;
+}
+
 /**
  * This method will return a vector of addressables for use. This is required
  * when we're asking for a subset of a vector or map.
@@ -377,5 +394,77 @@ void Object::NotifySubscribers() {
     subscriber->RebuildCache();
 }
 
+/**
+ * Check if any of the addressables that can be changed by other objects
+ * (estimates, profiles, projections, time varying etc) have a different value
+ * from the last time this was called. Addressables that are only registered
+ * for lookups are outputs of this object and are ignored.
+ *
+ * Every change increments the addressable version. With auto-differentiation
+ * everything is treated as changed so it is recorded on the tape.
+ *
+ * @return true if an addressable has changed since the last call
+ */
+bool Object::AddressablesChanged() {
+  unsigned index = 0;
+  bool changed = false;
+  auto compare = [&](const Double& value) {
+    if (index == addressable_values_.size()) {
+      addressable_values_.push_back(value);
+      changed = true;
+    } else if (AS_DOUBLE(addressable_values_[index]) != AS_DOUBLE(value)) {
+      addressable_values_[index] = value;
+      changed = true;
+    }
+    ++index;
+  };
+  auto is_input = [this](const string& label) {
+    auto iter = addressable_usage_.find(label);
+    return iter == addressable_usage_.end() || iter->second != addressable::kLookup;
+  };
+
+  for (auto& iter : addressables_) {
+    if (is_input(iter.first))
+      compare(*iter.second);
+  }
+  for (auto& iter : addressable_vectors_) {
+    if (is_input(iter.first)) {
+      for (const Double& value : *iter.second)
+        compare(value);
+    }
+  }
+  for (auto& iter : addressable_u_maps_) {
+    if (is_input(iter.first)) {
+      for (auto& value : *iter.second)
+        compare(value.second);
+    }
+  }
+  for (auto& iter : addressable_s_maps_) {
+    if (is_input(iter.first)) {
+      for (auto& value : *iter.second)
+        compare(value.second);
+    }
+  }
+  for (auto variables : unnamed_addressable_s_map_vector_) {
+    for (auto& iter : *variables) {
+      for (const Double& value : iter.second)
+        compare(value);
+    }
+  }
+
+  if (index != addressable_values_.size()) {
+    addressable_values_.resize(index);
+    changed = true;
+  }
+
+#ifdef USE_AUTODIFF
+  changed = true;
+#endif
+
+  if (changed)
+    ++addressable_version_;
+  return changed;
+}
+
 } /* namespace base */
 } /* namespace niwa */
@@ -79,6 +79,7 @@ public:
   unsigned                        GetAddressableSize(const string& label) const;
   Double*                         GetAddressable(const string& label);
   virtual Double*                 GetAddressable(const string& label, const string& index);
+  virtual unsigned                GetAddressableFirstYear(const string& label, const string& index) const;
   vector<Double*>*                GetAddressables(const string& absolute_label, const vector<string> indexes);
   map<unsigned, Double>*          GetAddressableUMap(const string& label);
   map<unsigned, Double>*          GetAddressableUMap(const string& label, bool& create_missing);
@@ -89,6 +90,7 @@ public:
   virtual void                    RebuildCache();
   void                            SubscribeToRebuildCache(Object* subscriber);
   void                            NotifySubscribers();
+  bool                            AddressablesChanged();
 
   // pure virtual methods
   virtual void                    Reset() = 0;
@@ -107,6 +109,9 @@ public:
   void                        set_estimated(bool value) { is_estimated_ = value;} // This should only be used in Estimate/Creator/EstimateTransformations
   void                        set_time_varying(bool value) { is_time_varying_ = value;} // This should only be TimeVarying.cpp
   string                      block_type() const { return block_type_; }
+  unsigned                    addressable_version() const { return addressable_version_; }
+  unsigned                    cache_rebuilds() const { return cache_rebuilds_; }
+  unsigned                    cache_rebuilds_skipped() const { return cache_rebuilds_skipped_; }
 
 protected:
   // Methods
@@ -130,6 +135,10 @@ protected:
   map<string, addressable::Type>  addressable_types_;
   map<string, addressable::Usage> addressable_usage_;
   vector<Object*>                 rebuild_cache_subscribers_;
+  unsigned                        addressable_version_  = 0;
+  vector<Double>                  addressable_values_; // values at the last AddressablesChanged()
+  unsigned                        cache_rebuilds_       = 0;
+  unsigned                        cache_rebuilds_skipped_ = 0;
 
   map<string, map<unsigned, Double>* >      addressable_u_maps_;
   map<string, OrderedMap<string, Double>* > addressable_s_maps_;
@@ -11,9 +11,7 @@
 // headers
 #include "EstimableValuesLoader.h"
 
-#include <fstream>
 #include <iostream>
-#include <vector>
 #include <boost/algorithm/string/replace.hpp>
 #include <boost/algorithm/string/trim_all.hpp>
 #include <boost/algorithm/string/split.hpp>
@@ -29,29 +27,48 @@
 namespace niwa {
 namespace configuration {
 
-using std::ifstream;
 using std::cout;
 using std::endl;
-using std::vector;
-using niwa::utilities::Double;
 
 /**
- * Load the values of our estimates from the file provided
+ * Check the values of our estimates in the file provided and hand the
+ * file to the estimables. Every row is read and converted here so any
+ * errors are reported before the model is run, but the values are not
+ * kept. The estimables read them again as each row is used.
  *
  * @param file_name The name of the file containing the values
  */
 void EstimableValuesLoader::LoadValues(const string& file_name) {
-  ifstream file_;
+  Open(file_name);
+
+  unsigned value_count = 0;
+  vector<Double> values;
+  while (NextRow(values))
+    ++value_count;
+  file_.close();
+
+  model_->managers().estimables()->SetValueFile(file_name, parameters_, value_count);
+}
+
+/**
+ * Open the file and read the first line, which should contain
+ * the list of parameters
+ *
+ * @param file_name The name of the file containing the values
+ */
+void EstimableValuesLoader::Open(const string& file_name) {
+  if (file_.is_open())
+    file_.close();
+  file_.clear();
+  file_name_ = file_name;
+  line_number_ = 0;
+  parameters_.clear();
+
   file_.open(file_name.c_str());
   if (file_.fail() || !file_.is_open())
     LOG_FATAL() << "Unable to open the estimate_value file: " << file_name << ". Does this file exist?";
 
-  /**
-   * Get the first line which should contain a list of parameters
-   */
-  string    current_line        = "";
-  vector<string> parameters;
-  unsigned line_number = 0;
+  string current_line = "";
   if (!getline(file_, current_line) || current_line == "")
     LOG_FATAL() << "estimable value file appears to be empty, or the first line is blank. File: " << file_name;
 
@@ -59,44 +76,48 @@ void EstimableValuesLoader::LoadValues(const string& file_name) {
   if(current_line == "*mcmc_sample[mcmc]") {
     LOG_FINEST() << "skipping line as it is an input from an MCMC report " << current_line;
     getline(file_, current_line);
-    ++line_number;
+    ++line_number_;
   }
 
   LOG_FINEST() << "current line: " << current_line;
 
   boost::replace_all(current_line, "\t", " ");
   boost::trim_all(current_line);
-  boost::split(parameters, current_line, boost::is_any_of(" "));
-
-  /**
-   * Iterate through file
-   */
-
-  vector<string> values;
-  Estimables& estimables = *model_->managers().estimables();
-  ++line_number;
-  while (getline(file_, current_line)) {
-    ++line_number;
-
-    boost::replace_all(current_line, "\t", " ");
-    boost::trim_all(current_line);
-    LOG_FINEST() << "current_line " << line_number << " in estimate_values: " << current_line;
-
-    boost::split(values, current_line, boost::is_any_of(" "));
-    if (values.size() != parameters.size())
-      LOG_FATAL() << "In estimate_value file, line " << line_number << " has " << values.size() << " values when we expected " << parameters.size();
-    for (unsigned i = 0; i < values.size(); ++i) {
-      boost::trim_all(parameters[i]);
-      boost::trim_all(values[i]);
-
-      Double numeric = 0.0;
-      if (!utilities::To<Double>(values[i], numeric))
-        LOG_FATAL() << "In estimate_value file could not convert the value " << values[i] << " to a double";
-      estimables.AddValue(parameters[i], numeric);
-    }
+  boost::split(parameters_, current_line, boost::is_any_of(" "));
+  for (string& parameter : parameters_)
+    boost::trim_all(parameter);
+  ++line_number_;
+}
+
+/**
+ * Read the values on the next line of the file
+ *
+ * @param values The vector to put the values in
+ * @return true if a line was read, false at the end of the file
+ */
+bool EstimableValuesLoader::NextRow(vector<Double>& values) {
+  string current_line = "";
+  if (!getline(file_, current_line))
+    return false;
+  ++line_number_;
+
+  boost::replace_all(current_line, "\t", " ");
+  boost::trim_all(current_line);
+  LOG_FINEST() << "current_line " << line_number_ << " in estimate_values: " << current_line;
+
+  vector<string> text_values;
+  boost::split(text_values, current_line, boost::is_any_of(" "));
+  if (text_values.size() != parameters_.size())
+    LOG_FATAL() << "In estimate_value file, line " << line_number_ << " has " << text_values.size() << " values when we expected " << parameters_.size();
+
+  values.resize(text_values.size());
+  for (unsigned i = 0; i < text_values.size(); ++i) {
+    boost::trim_all(text_values[i]);
+    if (!utilities::To<Double>(text_values[i], values[i]))
+      LOG_FATAL() << "In estimate_value file could not convert the value " << text_values[i] << " to a double";
   }
 
-  file_.close();
+  return true;
 }
 
 } /* namespace configuration */
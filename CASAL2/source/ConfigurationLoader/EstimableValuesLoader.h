@@ -15,12 +15,18 @@
  * Depending on the run mode the estimable values will be used different.
  * For a standard run the model will do N iterations where N is the amount
  * of values specified for the estimables.
+ *
+ * The file can have many thousands of rows (e.g. an MCMC sample) so the
+ * values are not kept in memory. The file is checked when it is loaded
+ * and the rows are read again one at a time when they are used.
  */
 #ifndef CONFIGURATION_ESTIMABLEVALUESLOADER_H_
 #define CONFIGURATION_ESTIMABLEVALUESLOADER_H_
 
 // headers
+#include <fstream>
 #include <string>
+#include <vector>
 
 #include "Model/Model.h"
 
@@ -29,6 +35,8 @@ namespace niwa {
 namespace configuration {
 
 using std::string;
+using std::vector;
+using niwa::utilities::Double;
 
 // classes
 class EstimableValuesLoader {
@@ -37,10 +45,19 @@ public:
   EstimableValuesLoader(Model* model) : model_(model) { }
   virtual                     ~EstimableValuesLoader() = default;
   void                        LoadValues(const string& file_name);
+  void                        Open(const string& file_name);
+  bool                        NextRow(vector<Double>& values);
+
+  // accessors
+  const vector<string>&       parameters() const { return parameters_; }
 
 private:
   // members
   Model*                    model_ = nullptr;
+  std::ifstream             file_;
+  string                    file_name_ = "";
+  vector<string>            parameters_;
+  unsigned                  line_number_ = 0;
 };
 
 } /* namespace configuration */
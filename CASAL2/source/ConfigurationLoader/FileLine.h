@@ -0,0 +1,36 @@
+/**
+ * @file FileLine.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * A single line loaded from a configuration file along with
+ * where it came from so we can report errors against it.
+ */
+#ifndef CONFIGURATION_FILELINE_H_
+#define CONFIGURATION_FILELINE_H_
+
+// Headers
+#include <string>
+
+// Namespaces
+namespace niwa {
+namespace configuration {
+
+using std::string;
+
+// structs
+struct FileLine {
+public:
+  string    file_name_      = "";
+  unsigned  line_number_    = 0;
+  string    line_           = "";
+};
+
+} /* namespace configuration */
+} /* namespace niwa */
+#endif /* CONFIGURATION_FILELINE_H_ */
@@ -98,6 +98,7 @@ void Loader::AddFileLine(FileLine line) {
  */
 void Loader::ParseFileLines() {
   LOG_TRACE();
+  model_.global_configuration().set_config_file_lines(file_lines_);
 
   vector<FileLine> block;
 
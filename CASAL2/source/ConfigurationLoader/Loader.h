@@ -24,6 +24,7 @@
 #include <string>
 
 #include "BaseClasses/Object.h"
+#include "ConfigurationLoader/FileLine.h"
 #include "Model/Model.h"
 #include "ParameterList/Table.h"
 
@@ -35,14 +36,6 @@ using std::vector;
 using std::string;
 using niwa::base::Object;
 
-// structs
-struct FileLine {
-public:
-  string    file_name_      = "";
-  unsigned  line_number_    = 0;
-  string    line_           = "";
-};
-
 // classes
 class Loader {
   friend class LoaderTest;
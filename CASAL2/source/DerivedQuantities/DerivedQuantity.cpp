@@ -105,6 +105,27 @@ void DerivedQuantity::Reset() {
     values_[year] = 0.0;
 }
 
+/**
+ * Save the values calculated so far (including the initialisation
+ * phases) so they can be restored when resuming from a checkpoint
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void DerivedQuantity::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("derived_quantity[" + label_ + "].values", values_);
+  checkpoint.Save("derived_quantity[" + label_ + "].initialisation_values", initialisation_values_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void DerivedQuantity::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("derived_quantity[" + label_ + "].values", values_);
+  checkpoint.Restore("derived_quantity[" + label_ + "].initialisation_values", initialisation_values_);
+}
+
 /**
  * Return the calculated value stored in this derived quantity
  * for the parameter year. If the year does not exist as a standard
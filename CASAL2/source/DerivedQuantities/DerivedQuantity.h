@@ -18,6 +18,7 @@
 
 // headers
 #include "BaseClasses/Executor.h"
+#include "Model/Checkpoint.h"
 #include "Partition/Accessors/Categories.h"
 
 // namespaces
@@ -37,6 +38,8 @@ public:
   void                        Validate();
   void                        Build();
   void                        Reset();
+  void                        SaveState(Checkpoint& checkpoint) const;
+  void                        RestoreState(const Checkpoint& checkpoint);
   Double                      GetValue(unsigned year);
   Double                      GetInitialisationValue(unsigned phase = 0, unsigned index = 0);
   Double                      GetLastValueFromInitialisation(unsigned phase);
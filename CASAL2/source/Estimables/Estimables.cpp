@@ -12,64 +12,103 @@
 // headers
 #include "Estimables.h"
 
+#include "ConfigurationLoader/EstimableValuesLoader.h"
 #include "Estimates/Manager.h"
 #include "GlobalConfiguration/GlobalConfiguration.h"
 #include "Model/Model.h"
 #include "Model/Objects.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Logging/Logging.h"
 
 // namespaces
 namespace niwa {
 
 /**
+ * Default constructor
+ */
+Estimables::Estimables(Model* model) : model_(model) { }
+
+/**
+ * Destructor
+ */
+Estimables::~Estimables() = default;
+
+/**
+ * Set the file the values are read from. The file has already been checked
+ * by the EstimableValuesLoader.
  *
+ * @param file_name The name of the file
+ * @param estimable_labels The estimables in the order of the columns in the file
+ * @param value_count The number of rows of values in the file
  */
-void Estimables::AddValue(const string& estimable_label, Double value) {
-  estimable_values_[estimable_label].push_back(value);
+void Estimables::SetValueFile(const string& file_name, const vector<string>& estimable_labels, unsigned value_count) {
+  file_name_        = file_name;
+  estimable_labels_ = estimable_labels;
+  value_count_      = value_count;
+  reader_.reset();
+  next_index_       = 0;
 }
 
 /**
  *
  */
 vector<string> Estimables::GetEstimables() const {
-  vector<string> result;
-  for (auto iter : estimable_values_)
-    result.push_back(iter.first);
-
-  return result;
+  return estimable_labels_;
 }
 
 /**
  *
  */
 unsigned Estimables::GetValueCount() const {
-  if (estimable_values_.size() == 0)
+  if (estimable_labels_.size() == 0)
     return 0;
 
-  auto iter = estimable_values_.begin();
-  return iter->second.size();
+  return value_count_;
 }
+
 /**
+ * Read the values on a row of the file. The rows are normally used in
+ * order so the file is kept open and only opened again if an earlier row
+ * is asked for.
  *
+ * @param index The index of the row
+ * @return The values of the estimables on the row
  */
-map<string, Double> Estimables::GetValues(unsigned index) const {
+map<string, Double> Estimables::GetValues(unsigned index) {
+  if (index >= value_count_)
+    LOG_CODE_ERROR() << "index (" << index << ") >= value_count_ (" << value_count_ << ")";
+
+  if (!reader_ || index < next_index_) {
+    reader_.reset(new configuration::EstimableValuesLoader(model_));
+    reader_->Open(file_name_);
+    next_index_ = 0;
+  }
+
+  vector<Double> values;
+  for (; next_index_ <= index; ++next_index_) {
+    if (!reader_->NextRow(values))
+      LOG_FATAL() << "The estimate_value file " << file_name_ << " has changed since it was loaded. It no longer has " << index + 1 << " rows of values";
+  }
+
   map<string, Double> result;
-  for (auto iter : estimable_values_)
-    result[iter.first] = iter.second[index];
+  for (unsigned i = 0; i < estimable_labels_.size(); ++i)
+    result[estimable_labels_[i]] = values[i];
 
   return result;
 }
 
 /**
+ * Set the estimables (and any estimates for them) to the values given
  *
+ * @param values The values to set
  */
-void Estimables::LoadValues(unsigned index) {
+void Estimables::SetValues(const map<string, Double>& values) {
   /**
    * load our estimables if they haven't been loaded already
    */
   if (estimables_.size() == 0) {
     string error = "";
-    for (auto iter : estimable_values_) {
+    for (auto iter : values) {
       if (!model_->objects().VerfiyAddressableForUse(iter.first, addressable::kInputRun, error)) {
         LOG_FATAL() << "The addressable " << iter.first << " could not be verified for use in -i run. Error was " << error;
       }
@@ -83,26 +122,37 @@ void Estimables::LoadValues(unsigned index) {
     if (model_->global_configuration().force_estimable_values_file()) {
       vector<Estimate*> estimates = model_->managers().estimate()->GetIsEstimated();
       for (auto estimate : estimates) {
-        if (estimable_values_.find(estimate->parameter()) == estimable_values_.end())
+        if (values.find(estimate->parameter()) == values.end())
           LOG_FATAL() << "The estimate " << estimate->parameter() << " has not been defined in the input file, even though force-estimates has been enabled";
       }
 
-      if (estimates.size() != estimable_values_.size())
-        LOG_FATAL() << "The estimate value file does not have the correct number of estimables defined. Expected " << estimates.size() << " but got " << estimable_values_.size();
+      if (estimates.size() != values.size())
+        LOG_FATAL() << "The estimate value file does not have the correct number of estimables defined. Expected " << estimates.size() << " but got " << values.size();
     }
   }
 
-  for (auto iter : estimables_) {
-    if (index >= estimable_values_[iter.first].size())
-      LOG_CODE_ERROR() << "index >= estimable_values_[iter.first].size()";
-    (*estimables_[iter.first]) = estimable_values_[iter.first][index];
+  // the cached scores were calculated with the previous values
+  model_->objective_function().ClearCache();
+
+  for (auto iter : values) {
+    if (estimables_.find(iter.first) == estimables_.end())
+      LOG_CODE_ERROR() << "estimables_.find(" << iter.first << ") == estimables_.end()";
+    (*estimables_[iter.first]) = iter.second;
 
     auto estimate = model_->managers().estimate()->GetEstimate(iter.first);
     if (estimate != nullptr)
-      estimate->set_value(estimable_values_[iter.first][index]);
+      estimate->set_value(iter.second);
   }
 }
 
+/**
+ * Load the values on a row of the file in to the estimables
+ *
+ * @param index The index of the row
+ */
+void Estimables::LoadValues(unsigned index) {
+  SetValues(GetValues(index));
+}
 
 
 
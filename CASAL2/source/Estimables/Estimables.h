@@ -12,6 +12,9 @@
  * Because we handle the values loaded by an input file differently depending on what
  * run mode we are in this class is responsible for loading the values from the input
  * file and making them available to the sub-systems that require them.
+ *
+ * The values are not held in memory. The rows are read from the file as
+ * they are asked for so files with many thousands of rows can be used.
  */
 #ifndef ESTIMABLES_H_
 #define ESTIMABLES_H_
@@ -34,6 +37,9 @@ using std::string;
 using std::vector;
 using std::map;
 class Model;
+namespace configuration {
+class EstimableValuesLoader;
+}
 
 // Enumerated Types
 enum class EstimableType {
@@ -51,18 +57,23 @@ enum class EstimableType {
 class Estimables {
 public:
   // methods
-  Estimables(Model* model) : model_(model) { };
-  virtual                       ~Estimables() = default;
-  void                          AddValue(const string& estimable_label, Double value);
+  Estimables(Model* model);
+  virtual                       ~Estimables();
+  void                          SetValueFile(const string& file_name, const vector<string>& estimable_labels, unsigned value_count);
   vector<string>                GetEstimables() const;
   unsigned                      GetValueCount() const;
-  map<string, Double>           GetValues(unsigned index) const;
+  map<string, Double>           GetValues(unsigned index);
+  void                          SetValues(const map<string, Double>& values);
   void                          LoadValues(unsigned index);
 
 private:
   // members
   Model*                        model_ = nullptr;
-  map<string, vector<Double>>   estimable_values_;
+  string                        file_name_ = "";
+  vector<string>                estimable_labels_;
+  unsigned                      value_count_ = 0;
+  std::unique_ptr<configuration::EstimableValuesLoader> reader_;
+  unsigned                      next_index_ = 0;
   map<string, Double*>          estimables_;
 
 };
@@ -29,6 +29,7 @@ namespace util = niwa::utilities;
 void GlobalConfiguration::Clear() {
   options_ = utilities::RunParameters();
   command_line_parameters_.clear();
+  config_file_lines_.clear();
 }
 
 /**
@@ -54,6 +55,12 @@ void GlobalConfiguration::ParseOptions(Model* model) {
     report->parameters().Add(PARAM_FILE_NAME, options_.output_, __FILE__, __LINE__);
     report->set_skip_tags(true);
   }
+
+  if (options_.timing_) {
+    auto report = reports::Factory::Create(model, PARAM_REPORT, PARAM_TIMING);
+    report->parameters().Add(PARAM_LABEL, PARAM_TIMING, __FILE__, __LINE__);
+    report->parameters().Add(PARAM_TYPE, PARAM_TIMING, __FILE__, __LINE__);
+  }
 }
 
 } /* namespace niwa */
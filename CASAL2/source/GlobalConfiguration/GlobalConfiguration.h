@@ -23,6 +23,7 @@
 #include <string>
 
 #include "BaseClasses/Object.h"
+#include "ConfigurationLoader/FileLine.h"
 #include "Translations/Translations.h"
 #include "Utilities/RunParameters.h"
 #include "Utilities/To.h"
@@ -52,11 +53,16 @@ public:
   void                  set_command_line_parameters(vector<string> &parameters) { command_line_parameters_ = parameters; }
   vector<string>&       command_line_parameters() { return command_line_parameters_; }
   void                  set_run_parameters(utilities::RunParameters& options) { options_ = options; }
+  const utilities::RunParameters& run_parameters() const { return options_; }
   bool                  debug_mode() { return options_.debug_mode_; }
   unsigned              random_seed() { return options_.random_number_seed_; }
   string                config_file() { return options_.config_file_; }
   unsigned              simulation_candidates() const { return options_.simulation_candidates_; }
   unsigned              projection_candidates() const { return options_.projection_candidates_; }
+  unsigned              mcmc_chains() const { return options_.mcmc_chains_; }
+  unsigned              estimation_starts() const { return options_.estimation_starts_; }
+  unsigned              threads() const { return options_.threads_; }
+  bool                  keep_mcmc_chain() const { return options_.keep_mcmc_chain_; }
   string                estimable_value_file() const { return options_.estimable_value_input_file_; }
   bool                  force_estimable_values_file() { return options_.force_estimables_as_named_; }
   bool                  disable_standard_report() { return options_.no_std_report_; }
@@ -71,11 +77,14 @@ public:
   bool                  create_mpd_file() const { return options_.create_mpd_file_; }
   unsigned              estimation_phases() const { return options_.estimation_phases_; }
   bool                  skip_estimation() const { return options_.skip_estimation_; }
+  void                  set_config_file_lines(const vector<configuration::FileLine>& lines) { config_file_lines_ = lines; }
+  const vector<configuration::FileLine>& config_file_lines() const { return config_file_lines_; }
 
 private:
   // Members
   vector<string>              command_line_parameters_;
   utilities::RunParameters    options_;
+  vector<configuration::FileLine> config_file_lines_;
   bool                        skip_loading_config_file_;
 };
 } /* namespace niwa */
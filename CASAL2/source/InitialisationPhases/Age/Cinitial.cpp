@@ -120,7 +120,7 @@ void Cinitial::DoBuild() {
 
   // Create Category and cached category pointers
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
   // Create derived quantity pointers
   unsigned i = 0;
   for (auto derived_quantities : derived_quanitity_) {
@@ -215,13 +215,12 @@ void Cinitial::Execute() {
 
 
   // set the partition back to Cinitial state
-  auto cached_partition_iter  = cached_partition_->Begin();
   partition_iter = partition_->Begin();
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
-      (*category_iter)->data_ = (*cached_category_iter).data_;
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
+      std::copy(cached_data, cached_data + (*category_iter)->data_.size(), (*category_iter)->data_.begin());
     }
   }
 }
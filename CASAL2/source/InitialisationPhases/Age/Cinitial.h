@@ -18,7 +18,7 @@
 // headers
 #include "InitialisationPhases/InitialisationPhase.h"
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 
 // namespaces
 namespace niwa {
@@ -27,7 +27,7 @@ class DerivedQuantity;
 namespace initialisationphases {
 namespace age {
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 
 /**
  * Class definition
@@ -47,7 +47,7 @@ protected:
 private:
   // members
   CombinedCategoriesPtr       partition_;
-  CachedCombinedCategoriesPtr cached_partition_;
+  SnapshotPtr                 cached_partition_;
   vector<string>              category_labels_;
   unsigned                    min_age_ = 0;
   unsigned                    max_age_ = 0;
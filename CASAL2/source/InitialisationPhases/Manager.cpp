@@ -52,6 +52,7 @@ void Manager::Validate() {
  */
 void Manager::Build(Model* model) {
   LOG_TRACE();
+  model_ = model;
 
   // Build our objects
   for(auto phase : objects_)
@@ -83,7 +84,9 @@ void Manager::Execute() {
 
   last_executed_phase_ = 0;
   for (current_initialisation_phase_ = 0; current_initialisation_phase_ < ordered_initialisation_phases_.size(); ++current_initialisation_phase_) {
-    ordered_initialisation_phases_[current_initialisation_phase_]->Execute();
+    InitialisationPhase* phase = ordered_initialisation_phases_[current_initialisation_phase_];
+    Timings::Timer timer(model_->timings(), phase, PARAM_INITIALISATION_PHASE, Timings::Method::kExecute);
+    phase->Execute();
     last_executed_phase_ = current_initialisation_phase_;
   }
 }
@@ -46,6 +46,7 @@ protected:
 
 private:
   // members
+  Model*                        model_ = nullptr;
   unsigned                      current_initialisation_phase_ = 0;
   unsigned                      last_executed_phase_ = 0;
   vector<InitialisationPhase*>  ordered_initialisation_phases_;
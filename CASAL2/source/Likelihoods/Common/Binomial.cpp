@@ -12,6 +12,7 @@
 
 // Headers
 #include <Likelihoods/Common/Binomial.h>
+#include "Model/Model.h"
 #include "Utilities/Math.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/RandomNumberGenerator.h"
@@ -44,15 +45,22 @@ Double Binomial::AdjustErrorValue(const Double process_error, const Double error
  */
 void Binomial::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+    vector<DataTerms>& terms = data_terms(year_iterator->first, year_iterator->second.size());
+    for (unsigned i = 0; i < year_iterator->second.size(); ++i) {
+      observations::Comparison& comparison = year_iterator->second[i];
       Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
       if (error_value == 0.0) {
         comparison.adjusted_error_ = error_value;
         comparison.score_ = 0.0;
       } else {
-        Double score = math::LnFactorial(error_value)
-                        - math::LnFactorial(error_value * (1.0 - comparison.observed_))
-                        - math::LnFactorial(error_value * comparison.observed_)
+        // the LnFactorial terms only depend on the data
+        if (!DataTermsValid(terms[i], error_value, comparison.observed_)) {
+          terms[i].first_ = math::LnFactorial(error_value)
+                            - math::LnFactorial(error_value * (1.0 - comparison.observed_))
+                            - math::LnFactorial(error_value * comparison.observed_);
+        }
+
+        Double score = terms[i].first_
                         + error_value * comparison.observed_ * log(dc::ZeroFun(comparison.expected_, comparison.delta_))
                         + error_value * (1.0 - comparison.observed_) * log(dc::ZeroFun(1.0 - comparison.expected_, comparison.delta_));
 
@@ -69,7 +77,7 @@ void Binomial::GetScores(map<unsigned, vector<observations::Comparison> >& compa
  * @param comparisons A collection of comparisons passed by the observation
  */
 void Binomial::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "Likelihoods/Factory.h"
+#include "Model/Model.h"
 #include "Observations/Comparison.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -29,16 +30,17 @@ using std::endl;
 using observations::Comparison;
 
 TEST(Likelihood, BinomialApprox) {
-  utilities::RandomNumberGenerator::Instance().Reset(31373u);
+  Model model;
+  model.random_number_generator().Reset(31373u);
 
-  BinomialApprox likelihood(nullptr);
+  BinomialApprox likelihood(&model);
 
   map<unsigned, vector<Comparison> > comparison_list;
 
   // Test case 1
   Comparison comparison;
   comparison.age_             = 0;
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.1;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -47,35 +49,35 @@ TEST(Likelihood, BinomialApprox) {
   comparison_list[0].push_back(comparison);
 
   // Test case 2
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.2;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 3
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.3;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 4
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.4;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 5
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 6
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -83,7 +85,7 @@ TEST(Likelihood, BinomialApprox) {
   comparison_list[0].push_back(comparison);
 
   // Test case 7
-  comparison.category_        = "C";
+  comparison.category_id_     = 2;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
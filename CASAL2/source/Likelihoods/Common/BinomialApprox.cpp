@@ -14,6 +14,7 @@
 #include <Likelihoods/Common/BinomialApprox.h>
 #include <cmath>
 
+#include "Model/Model.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -64,7 +65,7 @@ void BinomialApprox::GetScores(map<unsigned, vector<observations::Comparison> >&
  * @param comparisons A collection of comparisons passed by the observation
  */
 void BinomialApprox::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
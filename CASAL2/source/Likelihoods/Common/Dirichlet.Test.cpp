@@ -11,6 +11,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include "Model/Model.h"
 #include "Observations/Comparison.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -23,15 +24,16 @@ using std::endl;
 using observations::Comparison;
 
 TEST(Likelihood, Dirichlet) {
-  utilities::RandomNumberGenerator::Instance().Reset(31373u);
+  Model model;
+  model.random_number_generator().Reset(31373u);
 
-  Dirichlet likelihood(nullptr);
+  Dirichlet likelihood(&model);
   map<unsigned, vector<Comparison> > comparison_list;
 
   // Test case 1
   Comparison comparison;
   comparison.age_             = 0;
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.1;
   comparison.observed_        = 0.25;
   comparison.error_value_     = 50;
@@ -41,7 +43,7 @@ TEST(Likelihood, Dirichlet) {
 
 
   // Test case 2
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.2;
   comparison.observed_        = 0.25;
   comparison.error_value_     = 50;
@@ -50,7 +52,7 @@ TEST(Likelihood, Dirichlet) {
   comparison_list[0].push_back(comparison);
 
   // Test case 3
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.3;
   comparison.observed_        = 0.25;
   comparison.error_value_     = 50;
@@ -59,7 +61,7 @@ TEST(Likelihood, Dirichlet) {
   comparison_list[0].push_back(comparison);
 
   // Test case 4
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.4;
   comparison.observed_        = 0.25;
   comparison.error_value_     = 50;
@@ -68,7 +70,7 @@ TEST(Likelihood, Dirichlet) {
   comparison_list[0].push_back(comparison);
 
   // Test case 5
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.4;
   comparison.error_value_     = 50;
@@ -77,7 +79,7 @@ TEST(Likelihood, Dirichlet) {
   comparison_list[0].push_back(comparison);
 
   // Test case 6
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.6;
   comparison.error_value_     = 50;
@@ -86,7 +88,7 @@ TEST(Likelihood, Dirichlet) {
   comparison_list[0].push_back(comparison);
 
   // Test case 7
-  comparison.category_        = "C";
+  comparison.category_id_     = 2;
   comparison.expected_        = 1.0;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -14,6 +14,7 @@
 #include <cmath>
 #include <set>
 
+#include "Model/Model.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/Math.h"
 #include "Utilities/RandomNumberGenerator.h"
@@ -50,10 +51,16 @@ Double Dirichlet::AdjustErrorValue(const Double process_error, const Double erro
 
 void Dirichlet::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+    vector<DataTerms>& terms = data_terms(year_iterator->first, year_iterator->second.size());
+    for (unsigned i = 0; i < year_iterator->second.size(); ++i) {
+      observations::Comparison& comparison = year_iterator->second[i];
       Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
+      // log of the observed value only depends on the data
+      if (!DataTermsValid(terms[i], error_value, comparison.observed_))
+        terms[i].first_ = log(dc::ZeroFun(comparison.observed_,comparison.delta_));
+
       Double alpha = dc::ZeroFun(comparison.expected_,comparison.delta_) * error_value;
-      Double a2_a3 = math::LnGamma(alpha) - ((alpha - 1.0) * log(dc::ZeroFun(comparison.observed_,comparison.delta_)));
+      Double a2_a3 = math::LnGamma(alpha) - ((alpha - 1.0) * terms[i].first_);
 
       comparison.adjusted_error_ = error_value;
       comparison.score_ = a2_a3 * multiplier_;
@@ -70,8 +77,8 @@ void Dirichlet::GetScores(map<unsigned, vector<observations::Comparison> >& comp
 
 void Dirichlet::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
   // instance the random number generator
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-  map<string, Double> totals;
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
+  map<unsigned, Double> totals;
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
@@ -83,12 +90,12 @@ void Dirichlet::SimulateObserved(map<unsigned, vector<observations::Comparison>
       else
         comparison.observed_ = rng.gamma(AS_DOUBLE(comparison.expected_) * AS_DOUBLE(error_value));
 
-      totals[comparison.category_] += comparison.observed_;
+      totals[comparison.category_id_] += comparison.observed_;
       comparison.adjusted_error_ = error_value;
     }
 
     for (observations::Comparison& comparison : iterator->second)
-      comparison.observed_ /= totals[comparison.category_];
+      comparison.observed_ /= totals[comparison.category_id_];
   }
 }
 
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "Likelihoods/Factory.h"
+#include "Model/Model.h"
 #include "Observations/Comparison.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -29,9 +30,10 @@ using std::endl;
 using observations::Comparison;
 
 TEST(Likelihood, LogNormal) {
-  utilities::RandomNumberGenerator::Instance().Reset(31373u);
+  Model model;
+  model.random_number_generator().Reset(31373u);
 
-  LogNormal likelihood(nullptr);
+  LogNormal likelihood(&model);
 
   map<unsigned, vector<Comparison> > comparison_list;
 
@@ -39,7 +41,7 @@ TEST(Likelihood, LogNormal) {
   for (unsigned i = 0; i < 4; ++i) {
     Comparison comparison;
     comparison.age_             = 0;
-    comparison.category_        = "A";
+    comparison.category_id_     = 0;
     comparison.expected_        = 0.25;
     comparison.observed_        = 0.25;
     comparison.error_value_     = 0.0001;
@@ -51,7 +53,7 @@ TEST(Likelihood, LogNormal) {
   for (unsigned i = 0; i < 4; ++i) {
     Comparison comparison;
     comparison.age_             = 0;
-    comparison.category_        = "B";
+    comparison.category_id_     = 1;
     comparison.expected_        = 0.25;
     comparison.observed_        = 0.25;
     comparison.error_value_     = 0.5;
@@ -14,6 +14,7 @@
 #include <Likelihoods/Common/LogNormal.h>
 #include <cmath>
 
+#include "Model/Model.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -44,12 +45,19 @@ Double LogNormal::AdjustErrorValue(const Double process_error, const Double erro
  */
 void LogNormal::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+    vector<DataTerms>& terms = data_terms(year_iterator->first, year_iterator->second.size());
+    for (unsigned i = 0; i < year_iterator->second.size(); ++i) {
+      observations::Comparison& comparison = year_iterator->second[i];
 
       Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
-      Double sigma = sqrt(log(1 + error_value * error_value));
+      // sigma and log(sigma) only depend on the error value
+      if (!DataTermsValid(terms[i], error_value, comparison.observed_)) {
+        terms[i].first_  = sqrt(log(1 + error_value * error_value));
+        terms[i].second_ = log(terms[i].first_);
+      }
+      const Double& sigma = terms[i].first_;
       Double score = log(comparison.observed_ / dc::ZeroFun(comparison.expected_, comparison.delta_)) / sigma + 0.5 * sigma;
-      Double final_score = log(sigma) + 0.5 * (score * score);
+      Double final_score = terms[i].second_ + 0.5 * (score * score);
 
       comparison.adjusted_error_ = error_value;
       comparison.score_ = final_score * multiplier_;
@@ -63,7 +71,7 @@ void LogNormal::GetScores(map<unsigned, vector<observations::Comparison> >& comp
  * @param comparisons A collection of comparisons passed by the observation
  */
 void LogNormal::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "Likelihoods/Factory.h"
+#include "Model/Model.h"
 #include "Observations/Comparison.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -29,16 +30,17 @@ using std::endl;
 using observations::Comparison;
 
 TEST(Likelihood, Multinomial) {
-  utilities::RandomNumberGenerator::Instance().Reset(31373u);
+  Model model;
+  model.random_number_generator().Reset(31373u);
 
-  Multinomial likelihood(nullptr);
+  Multinomial likelihood(&model);
 
   map<unsigned, vector<Comparison> > comparison_list;
 
   // Test case 1
   Comparison comparison;
   comparison.age_             = 0;
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.1;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -47,35 +49,35 @@ TEST(Likelihood, Multinomial) {
   comparison_list[0].push_back(comparison);
 
   // Test case 2
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.2;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 3
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.3;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 4
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 0.4;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 5
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
   comparison_list[0].push_back(comparison);
 
   // Test case 6
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -83,7 +85,7 @@ TEST(Likelihood, Multinomial) {
   comparison_list[0].push_back(comparison);
 
   // Test case 7
-  comparison.category_        = "C";
+  comparison.category_id_     = 2;
   comparison.expected_        = 0.5;
   comparison.observed_        = 0.1;
   comparison.error_value_     = 50;
@@ -114,6 +116,43 @@ TEST(Likelihood, Multinomial) {
   EXPECT_DOUBLE_EQ(5.0,   comparison_list[0][6].observed_);
 }
 
+/**
+ * The data terms kept between calls must be made again when the
+ * process error or observed values change
+ */
+TEST(Likelihood, Multinomial_Cached_Data_Terms) {
+  Model model;
+  Multinomial likelihood(&model);
+
+  map<unsigned, vector<Comparison> > comparison_list;
+  Comparison comparison;
+  comparison.expected_        = 0.2;
+  comparison.observed_        = 0.1;
+  comparison.error_value_     = 50;
+  comparison.process_error_   = 10;
+  comparison.delta_           = 1e-5;
+  comparison_list[0].push_back(comparison);
+  comparison.expected_        = 0.8;
+  comparison.observed_        = 0.9;
+  comparison_list[0].push_back(comparison);
+
+  likelihood.GetScores(comparison_list);
+  Double first_score = comparison_list[0][0].score_;
+  likelihood.GetScores(comparison_list);
+  EXPECT_EQ(first_score, comparison_list[0][0].score_);
+
+  comparison_list[0][0].process_error_ = 20;
+  comparison_list[0][1].observed_      = 0.8;
+  likelihood.GetScores(comparison_list);
+
+  Multinomial new_likelihood(&model);
+  map<unsigned, vector<Comparison> > new_comparison_list = comparison_list;
+  new_likelihood.GetScores(new_comparison_list);
+  EXPECT_NE(first_score, comparison_list[0][0].score_);
+  EXPECT_EQ(new_comparison_list[0][0].score_, comparison_list[0][0].score_);
+  EXPECT_EQ(new_comparison_list[0][1].score_, comparison_list[0][1].score_);
+}
+
 }
 }
 
@@ -15,6 +15,7 @@
 #include <cmath>
 #include <set>
 
+#include "Model/Model.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/Math.h"
 #include "Utilities/RandomNumberGenerator.h"
@@ -42,14 +43,21 @@ Double Multinomial::AdjustErrorValue(const Double process_error, const Double er
 }
 
 /**
+ * Get the scores for each comparison. LnFactorial(N * observed) only
+ * depends on the data so it is kept between evaluations.
  *
+ * @param comparisons A collection of comparisons passed by the observation
  */
 void Multinomial::GetScores(map<unsigned, vector<observations::Comparison> >& comparisons) {
   for (auto year_iterator = comparisons.begin(); year_iterator != comparisons.end(); ++year_iterator) {
-    for (observations::Comparison& comparison : year_iterator->second) {
+    vector<DataTerms>& terms = data_terms(year_iterator->first, year_iterator->second.size());
+    for (unsigned i = 0; i < year_iterator->second.size(); ++i) {
+      observations::Comparison& comparison = year_iterator->second[i];
       Double error_value = AdjustErrorValue(comparison.process_error_, comparison.error_value_) * error_value_multiplier_;
+      if (!DataTermsValid(terms[i], error_value, comparison.observed_))
+        terms[i].first_ = math::LnFactorial(error_value * comparison.observed_);
 
-      Double score = math::LnFactorial(error_value * comparison.observed_)
+      Double score = terms[i].first_
                       - error_value * comparison.observed_ * log(dc::ZeroFun(comparison.expected_, comparison.delta_));
 
       comparison.adjusted_error_ = error_value;
@@ -87,7 +95,7 @@ Double Multinomial::GetInitialScore(map<unsigned, vector<observations::Compariso
  * @param comparisons A collection of comparisons passed by the observation
  */
 void Multinomial::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   auto iterator = comparisons.begin();
   for (; iterator != comparisons.end(); ++iterator) {
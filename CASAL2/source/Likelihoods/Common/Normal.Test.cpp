@@ -17,6 +17,7 @@
 #include <gtest/gtest.h>
 
 #include "Likelihoods/Factory.h"
+#include "Model/Model.h"
 #include "Observations/Comparison.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -29,16 +30,17 @@ using std::endl;
 using observations::Comparison;
 
 TEST(Likelihood, Normal) {
-  utilities::RandomNumberGenerator::Instance().Reset(31373u);
+  Model model;
+  model.random_number_generator().Reset(31373u);
 
-  Normal likelihood(nullptr);
+  Normal likelihood(&model);
 
   map<unsigned, vector<Comparison> > comparison_list;
 
   // Test case 1
   Comparison comparison;
   comparison.age_             = 0;
-  comparison.category_        = "A";
+  comparison.category_id_     = 0;
   comparison.expected_        = 500;
   comparison.observed_        = 1000;
   comparison.error_value_     = 0.25;
@@ -47,7 +49,7 @@ TEST(Likelihood, Normal) {
   comparison_list[0].push_back(comparison);
 
   // Test case 2
-  comparison.category_        = "B";
+  comparison.category_id_     = 1;
   comparison.expected_        = 500;
   comparison.observed_        = 1000;
   comparison.error_value_     = 0.25;
@@ -55,7 +57,7 @@ TEST(Likelihood, Normal) {
   comparison_list[0].push_back(comparison);
 
   // Test case 3
-  comparison.category_        = "C";
+  comparison.category_id_     = 2;
   comparison.expected_        = 500;
   comparison.observed_        = 500;
   comparison.error_value_     = 0.25;
@@ -63,7 +65,7 @@ TEST(Likelihood, Normal) {
   comparison_list[0].push_back(comparison);
 
   // Test case 4
-  comparison.category_        = "D";
+  comparison.category_id_     = 3;
   comparison.expected_        = 500;
   comparison.observed_        = 500;
   comparison.error_value_     = 0.25;
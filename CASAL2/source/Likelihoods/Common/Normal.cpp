@@ -12,6 +12,7 @@
 
 // Headers
 #include <Likelihoods/Common/Normal.h>
+#include "Model/Model.h"
 #include "Utilities/DoubleCompare.h"
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -61,7 +62,7 @@ void Normal::GetScores(map<unsigned, vector<observations::Comparison> >& compari
  * @param comparisons A collection of comparisons passed by the observation
  */
 void Normal::SimulateObserved(map<unsigned, vector<observations::Comparison> >& comparisons) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   Double error_value = 0.0;
   auto iterator = comparisons.begin();
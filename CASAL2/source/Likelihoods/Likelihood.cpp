@@ -32,5 +32,45 @@ void Likelihood::Validate() {
   DoValidate();
 }
 
+/**
+ * Get the cached data terms for the comparisons in a year. The terms
+ * are cleared if the number of comparisons has changed.
+ *
+ * @param year The year of the comparisons
+ * @param comparison_count The number of comparisons in the year
+ * @return The data terms for the year
+ */
+vector<Likelihood::DataTerms>& Likelihood::data_terms(unsigned year, unsigned comparison_count) {
+  vector<DataTerms>& terms = data_terms_[year];
+  if (terms.size() != comparison_count)
+    terms.assign(comparison_count, DataTerms());
+  return terms;
+}
+
+/**
+ * Check if the data terms were made from the same error value and
+ * observed value. If they were not the inputs are updated and the
+ * caller has to fill in the terms again.
+ *
+ * With auto-differentiation the terms are part of the tape so they
+ * are never reused.
+ *
+ * @param terms The terms to check
+ * @param error_value The adjusted error value of the comparison
+ * @param observed The observed value of the comparison
+ * @return true if the terms can be used, false otherwise
+ */
+bool Likelihood::DataTermsValid(DataTerms& terms, Double error_value, Double observed) {
+#ifndef USE_AUTODIFF
+  if (terms.valid_ && terms.error_value_ == error_value && terms.observed_ == observed)
+    return true;
+#endif
+
+  terms.error_value_ = error_value;
+  terms.observed_    = observed;
+  terms.valid_       = true;
+  return false;
+}
+
 } /* namespace niwa */
 
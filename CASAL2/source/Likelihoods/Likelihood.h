@@ -49,10 +49,29 @@ public:
   void                        set_type(const string& type) { type_ = type; }
 
 protected:
+  /**
+   * Parts of a comparison's score that only depend on the observed value
+   * and the adjusted error value. They are kept between evaluations and
+   * are only made again when one of the inputs changes (e.g. when the
+   * process error is estimated or the observed values are simulated).
+   */
+  struct DataTerms {
+    Double                    error_value_ = 0.0;
+    Double                    observed_ = 0.0;
+    Double                    first_ = 0.0;
+    Double                    second_ = 0.0;
+    bool                      valid_ = false;
+  };
+
+  // methods
+  vector<DataTerms>&          data_terms(unsigned year, unsigned comparison_count);
+  bool                        DataTermsValid(DataTerms& terms, Double error_value, Double observed);
+
   // members
   Model*                      model_ = nullptr;
   Double                      multiplier_ = 1.0;
   Double                      error_value_multiplier_ = 1.0;
+  map<unsigned, vector<DataTerms>> data_terms_;
 };
 } /* namespace niwa */
 #endif /* LIKELIHOOD_H_ */
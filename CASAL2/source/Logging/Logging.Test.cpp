@@ -0,0 +1,91 @@
+/**
+ * @file Logging.Test.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "Logging.h"
+
+#include <chrono>
+#include <gtest/gtest.h>
+
+#include "Model/Model.h"
+#include "TestResources/TestCases/CasalComplex1.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+
+// namespaces
+namespace niwa {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * The values streamed in to a log statement below the current
+ * log level are never evaluated. When the log statements are
+ * stripped this is true at every log level.
+ */
+TEST(Logging, Statements_Below_Log_Level_Are_Not_Evaluated) {
+  unsigned calls = 0;
+  auto count = [&calls]() { return ++calls; };
+
+  LOG_FINEST() << count();
+  LOG_FINE() << count();
+  LOG_MEDIUM() << count();
+  EXPECT_EQ(0u, calls);
+
+#ifdef STRIP_LOGGING
+  logger::Severity log_level = Logging::current_log_level_;
+  Logging::current_log_level_ = logger::Severity::kTrace;
+  LOG_TRACE();
+  LOG_FINEST() << count();
+  LOG_FINE() << count();
+  LOG_MEDIUM() << count();
+  Logging::current_log_level_ = log_level;
+  EXPECT_EQ(0u, calls);
+#endif
+}
+
+/**
+ * Print the average time taken for a full iteration of a model. Run the
+ * benchmarks in a build with and without STRIP_LOGGING to compare them.
+ */
+void BenchmarkEvaluation(Model* model, const string& name) {
+#ifdef STRIP_LOGGING
+  string log_statements = "stripped";
+#else
+  string log_statements = "kept";
+#endif
+
+  model->Start(RunMode::kBasic);
+
+  const unsigned iterations = 20;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < iterations; ++i)
+    model->FullIteration();
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "[ BENCHMARK] " << name << " with log statements " << log_statements << ": " << elapsed / iterations << " us per evaluation" << std::endl;
+  ::testing::Test::RecordProperty("microseconds_per_evaluation", (int)(elapsed / iterations));
+}
+
+TEST_F(InternalEmptyModel, Logging_TwoSex_Evaluation_Benchmark) {
+  AddConfigurationLine(testcases::test_cases_two_sex_model_population, "TwoSexModel.h", 27);
+  LoadConfiguration();
+  BenchmarkEvaluation(model_, "two_sex");
+}
+
+TEST_F(InternalEmptyModel, Logging_CasalComplex1_Evaluation_Benchmark) {
+  AddConfigurationLine(testcases::test_cases_casal_complex_1, "CasalComplex1.h", 31);
+  LoadConfiguration();
+  BenchmarkEvaluation(model_, "casal_complex_1");
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -58,6 +58,11 @@ void Logging::SetLogLevel(const std::string& log_level) {
     cout << "The log level provided is an invalid log level. " << log_level << " is not supported" << endl;
     exit(-1);
   }
+
+#ifdef STRIP_LOGGING
+  if (current_log_level_ < logger::Severity::kWarning)
+    cout << "This build of CASAL2 was compiled without the log statements below warning. The log level " << log_level << " will not print anything" << endl;
+#endif
 }
 
 #ifdef TESTMODE
@@ -65,6 +70,7 @@ void Logging::SetLogLevel(const std::string& log_level) {
  *
  */
 void Logging::Flush(niwa::logger::Record& record) {
+  std::lock_guard<std::mutex> lock(lock_);
   record.BuildMessage();
 
   if (record.severity() == logger::Severity::kWarning || record.severity() == logger::Severity::kError ||
@@ -81,6 +87,7 @@ void Logging::Flush(niwa::logger::Record& record) {
 }
 #else
 void Logging::Flush(niwa::logger::Record& record) {
+  std::lock_guard<std::mutex> lock(lock_);
   record.BuildMessage();
 
   if (record.severity() == logger::Severity::kWarning)
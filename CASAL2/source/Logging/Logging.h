@@ -17,6 +17,7 @@
 
 // headers
 #include <iostream>
+#include <mutex>
 #include <vector>
 #include <string>
 
@@ -56,6 +57,7 @@ private:
   // members
   std::vector<std::string>    warnings_;
   std::vector<std::string>    errors_;
+  std::mutex                  lock_;
 };
 
 } /* namespace niwa */
@@ -67,16 +69,28 @@ private:
  *
  * If we're building with TEST defined then we'll blank all of them except LOG_ERROR which
  * will throw an exception
+ *
+ * If we're building with STRIP_LOGGING defined then the levels below warning are
+ * compiled out. The statement is kept in a loop that never runs so it still has
+ * to compile, but nothing after the << is evaluated.
  */
 #define LOG_IF(level) if (level >= Logging::current_log_level_)
 #define LOG_FOR(level) for(logger::Record r(level, __FILE__, __FUNCTION__, __LINE__); !r.Flush(); Logging::Instance().Flush(r))
 #define LOG_IF_FOR(level) LOG_IF(level) LOG_FOR(level)
 #define LOG_IF_FOR_STREAM(level) LOG_IF_FOR(level) r.stream()
+#define LOG_STRIP(level) while (false) LOG_FOR(level)
 //
+#ifdef STRIP_LOGGING
+#define LOG_TRACE() LOG_STRIP(logger::Severity::kTrace);
+#define LOG_FINEST() LOG_STRIP(logger::Severity::kFinest) r.stream()
+#define LOG_FINE() LOG_STRIP(logger::Severity::kFine) r.stream()
+#define LOG_MEDIUM() LOG_STRIP(logger::Severity::kMedium) r.stream()
+#else
 #define LOG_TRACE() LOG_IF_FOR(logger::Severity::kTrace);
 #define LOG_FINEST() LOG_IF_FOR_STREAM(logger::Severity::kFinest)
 #define LOG_FINE() LOG_IF_FOR_STREAM(logger::Severity::kFine)
 #define LOG_MEDIUM() LOG_IF_FOR_STREAM(logger::Severity::kMedium)
+#endif
 #define LOG_WARNING() LOG_IF_FOR_STREAM(logger::Severity::kWarning)
 #define LOG_ERROR() LOG_IF_FOR_STREAM(logger::Severity::kError)
 #define LOG_ERROR_P(parameter) LOG_IF_FOR_STREAM(logger::Severity::kError) << this->parameters_.location(parameter)
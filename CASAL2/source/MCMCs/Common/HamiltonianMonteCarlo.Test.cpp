@@ -0,0 +1,87 @@
+/**
+ * @file HamiltonianMonteCarlo.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "HamiltonianMonteCarlo.h"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <boost/algorithm/string/replace.hpp>
+
+#include "Estimates/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "MCMCs/Manager.h"
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+
+// namespaces
+namespace niwa {
+namespace mcmcs {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * Run a short NUTS chain on the two sex model starting from an MPD file
+ * and check every sample is inside the bounds with a sensible acceptance rate
+ */
+TEST_F(InternalEmptyModel, MCMCs_HamiltonianMonteCarlo_TwoSex) {
+  string configuration = testcases::test_cases_two_sex_model_population;
+  boost::replace_first(configuration, "length 100", "type hamiltonian_monte_carlo\nlength 20\nwarmup 10\nmax_tree_depth 3");
+  AddConfigurationLine(configuration, __FILE__, 27);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.skip_estimation_ = true;
+  model_->global_configuration().set_run_parameters(parameters);
+
+  std::ofstream mpd("mpd.out");
+  mpd << "* MPD\n";
+  mpd << "estimate_values:\n";
+  mpd << "catchability[CPUEq].q process[Recruitment].R0 selectivity[FishingSel].a50 selectivity[FishingSel].ato95\n";
+  mpd << "0.000153139 997386 8 3\n";
+  mpd << "covariance_matrix:\n";
+  mpd << "1e-10 0 0 0\n";
+  mpd << "0 1e10 0 0\n";
+  mpd << "0 0 0.25 0\n";
+  mpd << "0 0 0 0.25\n";
+  mpd.close();
+
+  EXPECT_TRUE(model_->Start(RunMode::kMCMC));
+  std::remove("mpd.out");
+
+  MCMC* mcmc = model_->managers().mcmc()->active_mcmc();
+  ASSERT_NE(nullptr, dynamic_cast<HamiltonianMonteCarlo*>(mcmc));
+  EXPECT_EQ(20u, mcmc->link_count());
+
+  const mcmc::ChainLink& link = mcmc->last_link();
+  EXPECT_EQ(20u, link.iteration_);
+  EXPECT_TRUE(std::isfinite(AS_DOUBLE(link.score_)));
+  EXPECT_LT(0.0, AS_DOUBLE(link.step_size_));
+  EXPECT_LE(0.0, AS_DOUBLE(link.acceptance_rate_));
+  EXPECT_GE(1.0, AS_DOUBLE(link.acceptance_rate_));
+
+  vector<Estimate*> estimates = model_->managers().estimate()->GetIsEstimated();
+  ASSERT_EQ(estimates.size(), link.values_.size());
+  for (unsigned i = 0; i < estimates.size(); ++i) {
+    EXPECT_LE(AS_DOUBLE(estimates[i]->lower_bound()), AS_DOUBLE(link.values_[i])) << estimates[i]->parameter();
+    EXPECT_GE(AS_DOUBLE(estimates[i]->upper_bound()), AS_DOUBLE(link.values_[i])) << estimates[i]->parameter();
+  }
+
+  for (string file_name : { "mcmc_objectives.out", "mcmc_samples.out" })
+    std::remove(file_name.c_str());
+}
+
+} /* namespace mcmcs */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,471 @@
+/**
+ * @file HamiltonianMonteCarlo.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "HamiltonianMonteCarlo.h"
+
+#include <cmath>
+#include <limits>
+
+#ifdef USE_AUTODIFF
+#ifdef USE_ADOLC
+#include <adolc/adolc.h>
+#include <adolc/taping.h>
+#include <adolc/drivers/drivers.h>
+#endif
+#endif
+
+#include "Estimates/Manager.h"
+#include "EstimateTransformations/Manager.h"
+#include "Model/Model.h"
+#include "Model/Managers.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
+#include "Reports/Manager.h"
+#include "Utilities/RandomNumberGenerator.h"
+
+// namespaces
+namespace niwa {
+namespace mcmcs {
+
+namespace {
+// a trajectory that has lost this much energy has diverged
+const double kMaxEnergyError = 1000.0;
+// dual averaging constants from Hoffman & Gelman (2014)
+const double kGamma = 0.05;
+const double kT0 = 10.0;
+const double kKappa = 0.75;
+}
+
+/**
+ * Default constructor
+ */
+HamiltonianMonteCarlo::HamiltonianMonteCarlo(Model* model) : MCMC(model) {
+  parameters_.Bind<unsigned>(PARAM_KEEP, &keep_, "Spacing between recorded values in the MCMC", "", 1u);
+  parameters_.Bind<unsigned>(PARAM_WARMUP, &warmup_, "Number of iterations before the chain used to tune the step size. These are not recorded", "", 100u);
+  parameters_.Bind<unsigned>(PARAM_MAX_TREE_DEPTH, &max_tree_depth_, "Maximum depth of the trajectory tree, a trajectory has at most 2^depth steps", "", 10u);
+  parameters_.Bind<Double>(PARAM_TARGET_ACCEPTANCE_RATE, &target_acceptance_rate_, "Acceptance rate the step size is tuned to during the warmup", "", 0.8);
+  parameters_.Bind<Double>(PARAM_GRADIENT_STEP_SIZE, &gradient_step_size_, "Step size (as a multiplier of the standard deviation) for the central differences gradient. Not used with auto-differentiation", "", 1e-4);
+}
+
+/**
+ * Validate the parameters
+ */
+void HamiltonianMonteCarlo::DoValidate() {
+  if (length_ <= 0)
+    LOG_ERROR_P(PARAM_LENGTH) << "(" << length_ << ") cannot be less than or equal to 0";
+  if (keep_ < 1)
+    LOG_ERROR_P(PARAM_KEEP) << "(" << keep_ << ") cannot be less than 1";
+  if (max_tree_depth_ < 1 || max_tree_depth_ > 20)
+    LOG_ERROR_P(PARAM_MAX_TREE_DEPTH) << "(" << max_tree_depth_ << ") must be between 1 and 20";
+  if (target_acceptance_rate_ <= 0.0 || target_acceptance_rate_ >= 1.0)
+    LOG_ERROR_P(PARAM_TARGET_ACCEPTANCE_RATE) << "(" << target_acceptance_rate_ << ") must be between 0.0 and 1.0 (not inclusive)";
+  if (gradient_step_size_ <= 0.0)
+    LOG_ERROR_P(PARAM_GRADIENT_STEP_SIZE) << "(" << gradient_step_size_ << ") must be greater than 0.0";
+  if (step_size_ <= 0.0)
+    LOG_ERROR_P(PARAM_STEP_SIZE) << "(" << step_size_ << ") must be greater than 0.0";
+}
+
+/**
+ * Build the estimates we are sampling
+ */
+void HamiltonianMonteCarlo::DoBuild() {
+  LOG_TRACE();
+  estimates_ = model_->managers().estimate()->GetIsEstimated();
+  if (estimates_.size() == 0)
+    LOG_FATAL() << "Could not find any @estimates. these are needed to run in MCMC mode";
+  estimate_count_ = estimates_.size();
+
+  unsigned active_estimates = 0;
+  is_enabled_estimate_.assign(estimate_count_, false);
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    if (estimates_[i]->upper_bound() == estimates_[i]->lower_bound() || estimates_[i]->mcmc_fixed())
+      continue;
+    is_enabled_estimate_[i] = true;
+    active_estimates++;
+  }
+
+  if (active_estimates == 0)
+    LOG_ERROR() << "While building the MCMC system the number of active estimates was 0. You need at least 1 non-fixed MCMC estimate";
+}
+
+/**
+ * Run the model at the point and store the parts of the objective score.
+ * The point is in the objective function space of the estimates.
+ *
+ * @param point The point to evaluate
+ */
+void HamiltonianMonteCarlo::Evaluate(Point& point) {
+  point.valid_ = true;
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    if (estimates_[i]->lower_bound() > point.theta_[i] || estimates_[i]->upper_bound() < point.theta_[i]) {
+      LOG_MEDIUM() << "Estimate outside of bounds = " << estimates_[i]->parameter() << " value = " << point.theta_[i];
+      point.valid_ = false;
+      point.score_ = std::numeric_limits<double>::infinity();
+      return;
+    }
+  }
+
+  ++evaluations_;
+  model_->managers().estimate_transformation()->TransformEstimatesForObjectiveFunction();
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    estimates_[i]->set_value(point.theta_[i]);
+  model_->managers().estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+  model_->FullIteration();
+
+  ObjectiveFunction& obj_function = model_->objective_function();
+  obj_function.CalculateScore();
+  point.score_              = AS_DOUBLE(obj_function.score());
+  point.prior_              = AS_DOUBLE(obj_function.priors());
+  point.likelihood_         = AS_DOUBLE(obj_function.likelihoods());
+  point.penalty_            = AS_DOUBLE(obj_function.penalties());
+  point.additional_priors_  = AS_DOUBLE(obj_function.additional_priors());
+  point.jacobians_          = AS_DOUBLE(obj_function.jacobians());
+
+  point.values_.resize(estimate_count_);
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    point.values_[i] = AS_DOUBLE(estimates_[i]->value());
+
+  if (!std::isfinite(point.score_))
+    point.valid_ = false;
+}
+
+/**
+ * Calculate the gradient of the objective score at a point that has
+ * been evaluated. Fixed estimates have a gradient of 0.
+ *
+ * @param point The point
+ */
+void HamiltonianMonteCarlo::Gradient(Point& point) {
+  point.gradient_.assign(estimate_count_, 0.0);
+
+#if defined(USE_AUTODIFF) && defined(USE_ADOLC)
+  trace_on(1);
+  vector<adouble> candidates(estimate_count_);
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    candidates[i] <<= point.theta_[i];
+  model_->managers().estimate_transformation()->TransformEstimatesForObjectiveFunction();
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    estimates_[i]->set_value(candidates[i]);
+  model_->managers().estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+  model_->FullIteration();
+  model_->objective_function().CalculateScore();
+  adouble score = model_->objective_function().score();
+  double score_value = 0.0;
+  score >>= score_value;
+  trace_off();
+
+  vector<double> x = point.theta_;
+  gradient(1, estimate_count_, x.data(), point.gradient_.data());
+
+#elif defined(USE_AUTODIFF) && defined(USE_CPPAD)
+  vector<CppAD::AD<double>> candidates(point.theta_.begin(), point.theta_.end());
+  CppAD::Independent(candidates);
+  model_->managers().estimate_transformation()->TransformEstimatesForObjectiveFunction();
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    estimates_[i]->set_value(candidates[i]);
+  model_->managers().estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+  model_->FullIteration();
+  model_->objective_function().CalculateScore();
+  vector<CppAD::AD<double>> score(1, model_->objective_function().score());
+  CppAD::ADFun<double> function(candidates, score);
+  point.gradient_ = function.Jacobian(point.theta_);
+
+#else
+  /**
+   * Central differences with a step on the scale of each estimate. If one
+   * side is outside of the bounds we use the forward or backward difference
+   */
+  Point step;
+  step.theta_ = point.theta_;
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    if (!is_enabled_estimate_[i])
+      continue;
+
+    double h = AS_DOUBLE(gradient_step_size_) * std::sqrt(inverse_mass_[i]);
+    step.theta_[i] = point.theta_[i] + h;
+    Evaluate(step);
+    double upper = step.valid_ ? step.score_ : point.score_;
+    double upper_step = step.valid_ ? h : 0.0;
+
+    step.theta_[i] = point.theta_[i] - h;
+    Evaluate(step);
+    double lower = step.valid_ ? step.score_ : point.score_;
+    double lower_step = step.valid_ ? h : 0.0;
+
+    step.theta_[i] = point.theta_[i];
+    if (upper_step + lower_step > 0.0)
+      point.gradient_[i] = (upper - lower) / (upper_step + lower_step);
+  }
+#endif
+
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    if (!is_enabled_estimate_[i])
+      point.gradient_[i] = 0.0;
+  }
+}
+
+/**
+ * Take a single leapfrog step from the point
+ *
+ * @param point The point to move, this is evaluated at its new position
+ * @param r The momentum to update
+ * @param epsilon The step size (negative to go backwards in time)
+ */
+void HamiltonianMonteCarlo::Leapfrog(Point& point, vector<double>& r, double epsilon) {
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    r[i] -= 0.5 * epsilon * point.gradient_[i];
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    point.theta_[i] += epsilon * inverse_mass_[i] * r[i];
+
+  Evaluate(point);
+  if (!point.valid_)
+    return;
+  Gradient(point);
+
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    r[i] -= 0.5 * epsilon * point.gradient_[i];
+}
+
+/**
+ * @param r The momentum
+ * @return The kinetic energy for the momentum
+ */
+double HamiltonianMonteCarlo::KineticEnergy(const vector<double>& r) const {
+  double result = 0.0;
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    result += r[i] * r[i] * inverse_mass_[i];
+  return 0.5 * result;
+}
+
+/**
+ * @return true if the trajectory between the two ends has not started to turn back on itself
+ */
+bool HamiltonianMonteCarlo::NoUTurn(const Point& minus, const vector<double>& r_minus, const Point& plus, const vector<double>& r_plus) const {
+  double dot_minus = 0.0;
+  double dot_plus = 0.0;
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    double difference = plus.theta_[i] - minus.theta_[i];
+    dot_minus += difference * inverse_mass_[i] * r_minus[i];
+    dot_plus  += difference * inverse_mass_[i] * r_plus[i];
+  }
+  return dot_minus >= 0.0 && dot_plus >= 0.0;
+}
+
+/**
+ * Build a tree of 2^depth leapfrog steps from the point in the direction given
+ *
+ * @param point The edge of the existing tree to start from
+ * @param r The momentum at the point
+ * @param log_u The log of the slice variable
+ * @param direction -1 to go backwards in time and 1 to go forwards
+ * @param depth The depth of the tree
+ * @param epsilon The step size
+ * @param h0 The energy at the start of the trajectory
+ * @param tree The tree to fill
+ */
+void HamiltonianMonteCarlo::BuildTree(const Point& point, const vector<double>& r, double log_u, int direction, unsigned depth,
+    double epsilon, double h0, Tree& tree) {
+  if (depth == 0) {
+    Point next = point;
+    vector<double> r_next = r;
+    Leapfrog(next, r_next, direction * epsilon);
+    double h = next.valid_ ? next.score_ + KineticEnergy(r_next) : std::numeric_limits<double>::infinity();
+
+    tree.minus_    = next;
+    tree.r_minus_  = r_next;
+    tree.plus_     = next;
+    tree.r_plus_   = r_next;
+    tree.proposal_ = next;
+    tree.n_        = log_u <= -h ? 1 : 0;
+    tree.s_        = log_u < kMaxEnergyError - h;
+    tree.alpha_    = next.valid_ ? std::min(1.0, std::exp(h0 - h)) : 0.0;
+    tree.n_alpha_  = 1;
+    return;
+  }
+
+  BuildTree(point, r, log_u, direction, depth - 1, epsilon, h0, tree);
+  if (!tree.s_)
+    return;
+
+  Tree subtree;
+  if (direction == -1) {
+    BuildTree(tree.minus_, tree.r_minus_, log_u, direction, depth - 1, epsilon, h0, subtree);
+    tree.minus_   = subtree.minus_;
+    tree.r_minus_ = subtree.r_minus_;
+  } else {
+    BuildTree(tree.plus_, tree.r_plus_, log_u, direction, depth - 1, epsilon, h0, subtree);
+    tree.plus_    = subtree.plus_;
+    tree.r_plus_  = subtree.r_plus_;
+  }
+
+  if (subtree.n_ > 0 && model_->random_number_generator().uniform() < double(subtree.n_) / double(tree.n_ + subtree.n_))
+    tree.proposal_ = subtree.proposal_;
+
+  tree.alpha_   += subtree.alpha_;
+  tree.n_alpha_ += subtree.n_alpha_;
+  tree.s_        = subtree.s_ && NoUTurn(tree.minus_, tree.r_minus_, tree.plus_, tree.r_plus_);
+  tree.n_       += subtree.n_;
+}
+
+/**
+ * Find a starting step size where a single leapfrog step has an
+ * acceptance probability of about 0.5 (Hoffman & Gelman 2014, algorithm 4)
+ *
+ * @param point The starting point
+ * @return The step size
+ */
+double HamiltonianMonteCarlo::FindReasonableStepSize(const Point& point) {
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
+  vector<double> r0(estimate_count_, 0.0);
+  for (unsigned i = 0; i < estimate_count_; ++i) {
+    if (is_enabled_estimate_[i])
+      r0[i] = rng.normal(0.0, 1.0 / std::sqrt(inverse_mass_[i]));
+  }
+  double h0 = point.score_ + KineticEnergy(r0);
+
+  double epsilon = AS_DOUBLE(step_size_);
+  auto log_ratio = [&](double step) {
+    Point next = point;
+    vector<double> r = r0;
+    Leapfrog(next, r, step);
+    return next.valid_ ? h0 - next.score_ - KineticEnergy(r) : -std::numeric_limits<double>::infinity();
+  };
+
+  double ratio = log_ratio(epsilon);
+  double a = ratio > std::log(0.5) ? 1.0 : -1.0;
+  for (unsigned i = 0; i < 50 && a * ratio > -a * std::log(2.0); ++i) {
+    epsilon *= std::pow(2.0, a);
+    ratio = log_ratio(epsilon);
+  }
+
+  LOG_MEDIUM() << "Starting step size " << epsilon;
+  return epsilon;
+}
+
+/**
+ * Execute the MCMC system and build our MCMC chain
+ */
+void HamiltonianMonteCarlo::DoExecute() {
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
+
+  /**
+   * The variances from the MPD covariance matrix are the inverse mass
+   * matrix. Without one every estimate has unit mass.
+   */
+  inverse_mass_.assign(estimate_count_, 1.0);
+  if (covariance_matrix_.size1() == estimate_count_ && covariance_matrix_.size2() == estimate_count_) {
+    for (unsigned i = 0; i < estimate_count_; ++i) {
+      if (covariance_matrix_(i, i) > 0.0)
+        inverse_mass_[i] = AS_DOUBLE(covariance_matrix_(i, i));
+    }
+  } else {
+    covariance_matrix_ = ublas::identity_matrix<Double>(estimate_count_);
+  }
+
+  Point current;
+  current.theta_.resize(estimate_count_);
+  model_->managers().estimate_transformation()->TransformEstimatesForObjectiveFunction();
+  for (unsigned i = 0; i < estimate_count_; ++i)
+    current.theta_[i] = AS_DOUBLE(estimates_[i]->value());
+  model_->managers().estimate_transformation()->RestoreEstimatesFromObjectiveFunction();
+
+  Evaluate(current);
+  if (!current.valid_)
+    LOG_FATAL() << "The starting point of the MCMC is outside the bounds of the estimates or has an invalid objective score";
+  Gradient(current);
+
+  double epsilon = warmup_ > 0 ? FindReasonableStepSize(current) : AS_DOUBLE(step_size_);
+  double mu = std::log(10.0 * epsilon);
+  double h_bar = 0.0;
+  double log_epsilon_bar = 0.0;
+
+  double acceptance_total = 0.0;
+  vector<double> r0(estimate_count_, 0.0);
+  LOG_MEDIUM() << "MCMC Starting";
+  for (unsigned iteration = 1; iteration <= warmup_ + length_; ++iteration) {
+    for (unsigned i = 0; i < estimate_count_; ++i)
+      r0[i] = is_enabled_estimate_[i] ? rng.normal(0.0, 1.0 / std::sqrt(inverse_mass_[i])) : 0.0;
+
+    double h0 = current.score_ + KineticEnergy(r0);
+    double log_u = std::log(rng.uniform()) - h0;
+
+    Tree tree;
+    tree.minus_   = current;
+    tree.r_minus_ = r0;
+    tree.plus_    = current;
+    tree.r_plus_  = r0;
+    tree.n_       = 1;
+
+    double alpha = 0.0;
+    unsigned n_alpha = 1;
+    for (unsigned depth = 0; tree.s_ && depth < max_tree_depth_; ++depth) {
+      int direction = rng.uniform() < 0.5 ? -1 : 1;
+      Tree subtree;
+      if (direction == -1) {
+        BuildTree(tree.minus_, tree.r_minus_, log_u, direction, depth, epsilon, h0, subtree);
+        tree.minus_   = subtree.minus_;
+        tree.r_minus_ = subtree.r_minus_;
+      } else {
+        BuildTree(tree.plus_, tree.r_plus_, log_u, direction, depth, epsilon, h0, subtree);
+        tree.plus_    = subtree.plus_;
+        tree.r_plus_  = subtree.r_plus_;
+      }
+
+      if (subtree.s_ && subtree.n_ > 0 && rng.uniform() < double(subtree.n_) / double(tree.n_))
+        current = subtree.proposal_;
+
+      tree.n_ += subtree.n_;
+      tree.s_  = subtree.s_ && NoUTurn(tree.minus_, tree.r_minus_, tree.plus_, tree.r_plus_);
+      alpha    = subtree.alpha_;
+      n_alpha  = subtree.n_alpha_;
+    }
+    double acceptance_rate = alpha / n_alpha;
+
+    if (iteration <= warmup_) {
+      // dual averaging of the step size
+      double m = iteration;
+      h_bar = (1.0 - 1.0 / (m + kT0)) * h_bar + (AS_DOUBLE(target_acceptance_rate_) - acceptance_rate) / (m + kT0);
+      double log_epsilon = mu - std::sqrt(m) / kGamma * h_bar;
+      double weight = std::pow(m, -kKappa);
+      log_epsilon_bar = weight * log_epsilon + (1.0 - weight) * log_epsilon_bar;
+      epsilon = std::exp(log_epsilon);
+      if (iteration == warmup_) {
+        epsilon = std::exp(log_epsilon_bar);
+        LOG_MEDIUM() << "Step size after warmup " << epsilon;
+      }
+      continue;
+    }
+
+    unsigned sample = iteration - warmup_;
+    acceptance_total += acceptance_rate;
+    if (sample % keep_ == 0) {
+      mcmc::ChainLink new_link;
+      new_link.iteration_                   = sample;
+      new_link.penalty_                     = current.penalty_;
+      new_link.score_                       = current.score_;
+      new_link.prior_                       = current.prior_;
+      new_link.likelihood_                  = current.likelihood_;
+      new_link.additional_priors_           = current.additional_priors_;
+      new_link.jacobians_                   = current.jacobians_;
+      new_link.acceptance_rate_             = acceptance_total / sample;
+      new_link.acceptance_rate_since_adapt_ = acceptance_rate;
+      new_link.step_size_                   = epsilon;
+      new_link.values_                      = current.values_;
+      AddLink(new_link);
+      model_->managers().report()->Execute(State::kIterationComplete);
+    }
+  }
+
+  step_size_ = epsilon;
+  LOG_MEDIUM() << "MCMC finished after " << evaluations_ << " model evaluations";
+}
+
+} /* namespace mcmcs */
+} /* namespace niwa */
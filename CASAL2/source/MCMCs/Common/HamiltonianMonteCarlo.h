@@ -0,0 +1,106 @@
+/**
+ * @file HamiltonianMonteCarlo.h
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * Hamiltonian Monte Carlo using the No-U-Turn Sampler (Hoffman & Gelman
+ * 2014, algorithm 6). The objective score is used as the potential energy
+ * and the variances from the MPD covariance matrix as the (diagonal)
+ * inverse mass matrix so the momentum is on the scale of each estimate.
+ *
+ * The step size is tuned with dual averaging during the warmup. The
+ * gradient comes from the auto-differentiation system in the ADOLC and
+ * CppAD builds and from central differences in the other builds.
+ *
+ * Points outside the bounds of the estimates have infinite energy so
+ * the trajectory stops there.
+ */
+#ifndef SOURCE_MCMCS_COMMON_HAMILTONIANMONTECARLO_H_
+#define SOURCE_MCMCS_COMMON_HAMILTONIANMONTECARLO_H_
+
+// headers
+#include "MCMCs/MCMC.h"
+
+// namespaces
+namespace niwa {
+class Estimate;
+
+namespace mcmcs {
+
+/**
+ * Class definition
+ */
+class HamiltonianMonteCarlo : public MCMC {
+public:
+  // methods
+  HamiltonianMonteCarlo(Model* model);
+  virtual                     ~HamiltonianMonteCarlo() = default;
+  void                        DoExecute() override final;
+
+protected:
+  /**
+   * A point on the trajectory with everything needed to
+   * record it as a link in the chain
+   */
+  struct Point {
+    vector<double>            theta_;
+    vector<double>            gradient_;
+    double                    score_ = 0.0;
+    double                    prior_ = 0.0;
+    double                    likelihood_ = 0.0;
+    double                    penalty_ = 0.0;
+    double                    additional_priors_ = 0.0;
+    double                    jacobians_ = 0.0;
+    vector<Double>            values_;
+    bool                      valid_ = false;
+  };
+
+  /**
+   * The state of a sub-tree returned by BuildTree()
+   */
+  struct Tree {
+    Point                     minus_;
+    vector<double>            r_minus_;
+    Point                     plus_;
+    vector<double>            r_plus_;
+    Point                     proposal_;
+    unsigned                  n_ = 0;
+    bool                      s_ = true;
+    double                    alpha_ = 0.0;
+    unsigned                  n_alpha_ = 0;
+  };
+
+  // methods
+  void                        DoValidate() override final;
+  void                        DoBuild() override final;
+  void                        Evaluate(Point& point);
+  void                        Gradient(Point& point);
+  void                        Leapfrog(Point& point, vector<double>& r, double epsilon);
+  double                      KineticEnergy(const vector<double>& r) const;
+  void                        BuildTree(const Point& point, const vector<double>& r, double log_u, int direction, unsigned depth,
+                                  double epsilon, double h0, Tree& tree);
+  double                      FindReasonableStepSize(const Point& point);
+  bool                        NoUTurn(const Point& minus, const vector<double>& r_minus, const Point& plus, const vector<double>& r_plus) const;
+
+  // members
+  unsigned                    keep_ = 0;
+  unsigned                    warmup_ = 0;
+  unsigned                    max_tree_depth_ = 0;
+  Double                      target_acceptance_rate_ = 0.0;
+  Double                      gradient_step_size_ = 0.0;
+  unsigned                    estimate_count_ = 0;
+  vector<Estimate*>           estimates_;
+  vector<bool>                is_enabled_estimate_;
+  vector<double>              inverse_mass_;
+  unsigned                    evaluations_ = 0;
+};
+
+} /* namespace mcmcs */
+} /* namespace niwa */
+
+#endif /* SOURCE_MCMCS_COMMON_HAMILTONIANMONTECARLO_H_ */
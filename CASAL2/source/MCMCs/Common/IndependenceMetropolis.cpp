@@ -237,7 +237,7 @@ void IndependenceMetropolis::GenerateRandomStart() {
  * Fill the candidates with an attempt using a multivariate normal
  */
 void IndependenceMetropolis::FillMultivariateNormal(Double step_size) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   vector<Double>  normals(estimate_count_ , 0.0);
   for (unsigned i = 0; i < estimate_count_; ++i) {
@@ -272,7 +272,7 @@ void IndependenceMetropolis::FillMultivariateNormal(Double step_size) {
  * Fill candidates with an attempt using a multivariate
  */
 void IndependenceMetropolis::FillMultivariateT(Double step_size) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
 
   vector<Double>  normals(estimate_count_, 0.0);
   vector<Double>  chisquares(estimate_count_, 0.0);
@@ -342,39 +342,20 @@ void IndependenceMetropolis::UpdateCovarianceMatrix() {
     if (std::find(adapt_covariance_matrix_.begin(), adapt_covariance_matrix_.end(), jumps_) == adapt_covariance_matrix_.end())
       return;
     recalculate_covariance_ = true;
-    LOG_MEDIUM() << "Re calculating covariance matrix, after " << chain_.size() << " iterations";
+    LOG_MEDIUM() << "Re calculating covariance matrix, after " << link_count_ << " iterations";
     // modify the covaraince matrix this algorithm is stolen from CASAL, maybe not the best place to take it from
-    //number of parameters
-    int n_params = chain_[0].values_.size();
-    // number of iterations
-    int n_iter = chain_.size() - 1;
+    // the running covariance has every link except the last one
+    int n_params = running_covariance_.size();
+    int n_iter = running_covariance_.count();
     LOG_MEDIUM() << "Number of parameters = " << n_params << ", number of iterations used to recalculate covariance = " << n_iter;
     // temp covariance matrix
     ublas::matrix<Double> temp_covariance = covariance_matrix_;
-    // Mean parameter vector
-    vector<Double> mean_var(n_params, 1.0);
     for (int i = 0; i < n_params; ++i) {
-      Double sx = 0.0;
-      for (int k = 0; k < n_iter; ++k) {
-       sx +=  chain_[k].values_[i];
-      }
-      mean_var[i] = sx / n_iter;
-
-      LOG_MEDIUM() << "Total = " << sx << "\n";
-      LOG_MEDIUM() << "Mean = " << mean_var[i]  << "\n";
+      LOG_MEDIUM() << "Mean = " << running_covariance_.mean()[i]  << "\n";
 
-      Double sxx = 0.0;
-      for (int k = 0; k < n_iter; ++k) {
-       sxx += pow(chain_[k].values_[i] - mean_var[i],2);
-      }
-      Double var = sxx / (n_iter - 1);
-      temp_covariance(i,i) = var;
+      temp_covariance(i,i) = running_covariance_.covariance(i, i);
       for (int j = 0; j < i; j++){
-        Double sxy = 0;
-        for (int k = 0; k < n_iter; k++){
-          sxy += (chain_[k].values_[i] - mean_var[i]) * (chain_[k].values_[j] - mean_var[j]);
-        }
-        Double cov = (sxy / (n_iter - 1));
+        Double cov = running_covariance_.covariance(i, j);
         temp_covariance(i,j) = cov;
         temp_covariance(j,i) = cov;
       }
@@ -594,7 +575,7 @@ void IndependenceMetropolis::DoExecute() {
     new_link.acceptance_rate_since_adapt_   = 0;
     new_link.step_size_                     = step_size_;
     new_link.values_                        = previous_untransformed_candidates;
-    chain_.push_back(new_link);
+    AddLink(new_link);
     // Print first value
 		model_->managers().report()->Execute(State::kIterationComplete);
 
@@ -603,7 +584,7 @@ void IndependenceMetropolis::DoExecute() {
   /**
    * Now we start the MCMC process
    */
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
   LOG_MEDIUM() << "MCMC Starting";
   LOG_MEDIUM() << "Covariance matrix has rows = " << covariance_matrix_.size1() << " and cols = " << covariance_matrix_.size2();
   LOG_MEDIUM() << "Estimate Count: " << estimate_count_;
@@ -704,7 +685,7 @@ void IndependenceMetropolis::DoExecute() {
 			new_link.acceptance_rate_since_adapt_ = Double(successful_jumps_since_adapt_) / Double(jumps_since_adapt_);
 			new_link.step_size_ = step_size_;
 			new_link.values_ = previous_untransformed_candidates;
-			chain_.push_back(new_link);
+			AddLink(new_link);
 			//LOG_MEDIUM() << "Storing: Successful Jumps " << successful_jumps_ << " Jumps : " << jumps_;
 			model_->managers().report()->Execute(State::kIterationComplete);
 		}
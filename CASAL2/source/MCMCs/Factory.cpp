@@ -15,6 +15,7 @@
 #include "Model/Model.h"
 #include "Model/Managers.h"
 #include "MCMCs/Manager.h"
+#include "MCMCs/Common/HamiltonianMonteCarlo.h"
 #include "MCMCs/Common/IndependenceMetropolis.h"
 
 // namespaces
@@ -30,6 +31,8 @@ MCMC* Factory::Create(Model* model, const string& object_type, const string& sub
   if (object_type == PARAM_MCMC) {
     if (sub_type == "" || sub_type == PARAM_INDEPENDENCE_METROPOLIS || sub_type == PARAM_METROPOLIS_HASTINGS)
       object = new IndependenceMetropolis(model);
+    else if (sub_type == PARAM_HAMILTONIAN_MONTE_CARLO || sub_type == PARAM_NUTS)
+      object = new HamiltonianMonteCarlo(model);
   }
 
   if (object)
@@ -16,6 +16,7 @@
 #include "Model/Managers.h"
 #include "Model/Model.h"
 #include "Reports/Manager.h"
+#include "Reports/Common/MCMCConvergence.h"
 #include "Reports/Common/MCMCObjective.h"
 #include "Reports/Common/MCMCSample.h"
 
@@ -88,6 +89,20 @@ void MCMC::Build() {
       model_->managers().report()->AddObject(sample_report);
     }
 
+    // Multiple chains always get their diagnostics written out
+    if (model_->global_configuration().mcmc_chains() > 1 && !model_->managers().report()->HasType(PARAM_MCMC_CONVERGENCE)) {
+      reports::MCMCConvergence* convergence_report = new reports::MCMCConvergence(model_);
+      convergence_report->set_block_type(PARAM_REPORT);
+      convergence_report->set_defined_file_name(__FILE__);
+      convergence_report->set_defined_line_number(__LINE__);
+      convergence_report->parameters().Add(PARAM_LABEL, "mcmc_convergence", __FILE__, __LINE__);
+      convergence_report->parameters().Add(PARAM_TYPE, PARAM_MCMC_CONVERGENCE, __FILE__, __LINE__);
+      convergence_report->parameters().Add(PARAM_FILE_NAME, "mcmc_convergence.out", __FILE__, __LINE__);
+      convergence_report->parameters().Add(PARAM_WRITE_MODE, PARAM_INCREMENTAL_SUFFIX, __FILE__, __LINE__);
+      convergence_report->Validate();
+      model_->managers().report()->AddObject(convergence_report);
+    }
+
     model_->managers().report()->Resume();
   } else if (model_->global_configuration().resume() && print_default_reports_) {
     model_->managers().report()->Pause();
@@ -126,6 +141,8 @@ void MCMC::Build() {
     model_->managers().report()->Resume();
   }
 
+  keep_chain_ = model_->global_configuration().mcmc_chains() > 1 || model_->global_configuration().keep_mcmc_chain();
+
   DoBuild();
 }
 
@@ -142,4 +159,23 @@ void MCMC::Execute() {
 
   DoExecute();
 }
+
+/**
+ * Add a link to the chain. The link that was last becomes part of the
+ * running covariance used for the adaptation, and the new link is kept
+ * for the reports to print.
+ *
+ * @param link The new link
+ */
+void MCMC::AddLink(const mcmc::ChainLink& link) {
+  if (link_count_ == 0)
+    running_covariance_.Reset(link.values_.size());
+  else
+    running_covariance_.Add(last_link_.values_);
+
+  last_link_ = link;
+  ++link_count_;
+  if (keep_chain_)
+    chain_.push_back(link);
+}
 } /* namespace niwa */
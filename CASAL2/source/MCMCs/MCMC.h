@@ -9,6 +9,11 @@
  * @section DESCRIPTION
  *
  * Markov Chain Monte Carlo
+ *
+ * Each link is handed to the reports as it is made and the adaptation
+ * uses a running covariance, so the memory used does not grow with the
+ * length of the chain. The whole chain is only kept when it is needed
+ * for the convergence diagnostics of multiple chains.
  */
 
 #ifndef MCMC_H_
@@ -18,6 +23,7 @@
 #include <boost/numeric/ublas/matrix.hpp>
 
 #include "BaseClasses/Object.h"
+#include "MCMCs/RunningCovariance.h"
 
 // namespaces
 namespace niwa {
@@ -43,6 +49,16 @@ struct ChainLink {
   Double          step_size_;
   vector<Double>  values_;
 };
+
+/**
+ * Struct definition for the convergence diagnostics
+ * of a single parameter across multiple chains
+ */
+struct Convergence {
+  string          parameter_;
+  double          r_hat_;
+  double          effective_sample_size_;
+};
 }
 
 /**
@@ -61,6 +77,9 @@ public:
 
   // accessors/mutators
   vector<mcmc::ChainLink>&    chain() { return chain_; }
+  const mcmc::ChainLink&      last_link() const { return last_link_; }
+  unsigned                    link_count() const { return link_count_; }
+  bool                        keep_chain() const { return keep_chain_; }
   bool                        active() const { return active_; }
   ublas::matrix<Double>&      covariance_matrix() {return covariance_matrix_;}
   void                        set_starting_iteration(unsigned value) { starting_iteration_ = value; }
@@ -68,6 +87,8 @@ public:
   void                        set_step_size(Double value) { step_size_ = value; }
   void                        set_acceptance_rate_from_last_adapt(Double value) { acceptance_rate_since_last_adapt_ = value; }
   bool                        recalculate_covariance() const { return recalculate_covariance_; }
+  const vector<mcmc::Convergence>& convergence() const { return convergence_; }
+  void                        set_convergence(const vector<mcmc::Convergence>& value) { convergence_ = value; }
 
 protected:
   // pure virtual methods
@@ -75,12 +96,20 @@ protected:
   virtual void                DoBuild() = 0;
   virtual void                DoExecute() = 0;
 
+  // methods
+  void                        AddLink(const mcmc::ChainLink& link);
+
   // members
   Model*                      model_;
   unsigned                    length_ = 0;
   unsigned                    starting_iteration_ = 0;
   ublas::matrix<Double>       covariance_matrix_;
   vector<mcmc::ChainLink>     chain_;
+  mcmc::ChainLink             last_link_;
+  unsigned                    link_count_ = 0;
+  bool                        keep_chain_ = false;
+  mcmc::RunningCovariance     running_covariance_; // every link except the last
+  vector<mcmc::Convergence>   convergence_;
 
   bool                        active_;
   bool                        print_default_reports_;
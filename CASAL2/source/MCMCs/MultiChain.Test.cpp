@@ -0,0 +1,202 @@
+/**
+ * @file MultiChain.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "MultiChain.h"
+
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "MCMCs/Manager.h"
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+#include "Utilities/RandomNumberGenerator.h"
+
+// namespaces
+namespace niwa {
+namespace mcmcs {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * Build chains of independent normal draws, chain c has mean offset * c
+ */
+vector<vector<double>> BuildChains(unsigned chains, unsigned length, double offset) {
+  utilities::RandomNumberGenerator rng;
+  rng.Reset(31415);
+
+  vector<vector<double>> result(chains, vector<double>(length, 0.0));
+  for (unsigned c = 0; c < chains; ++c) {
+    for (unsigned i = 0; i < length; ++i)
+      result[c][i] = rng.normal(offset * c, 1.0);
+  }
+  return result;
+}
+
+/**
+ * Chains sampling the same distribution should have an
+ * R-hat close to 1 and an ESS close to the number of samples
+ */
+TEST(MCMCs_MultiChain, Convergence_Mixed) {
+  vector<vector<double>> chains = BuildChains(4, 1000, 0.0);
+
+  EXPECT_NEAR(1.0, MultiChain::RHat(chains), 0.01);
+  double ess = MultiChain::EffectiveSampleSize(chains);
+  EXPECT_GT(ess, 3000.0);
+  EXPECT_LT(ess, 5000.0);
+}
+
+/**
+ * Chains stuck in different places should have a large R-hat
+ * and a small effective sample size
+ */
+TEST(MCMCs_MultiChain, Convergence_NotMixed) {
+  vector<vector<double>> chains = BuildChains(4, 1000, 5.0);
+
+  EXPECT_GT(MultiChain::RHat(chains), 2.0);
+  EXPECT_LT(MultiChain::EffectiveSampleSize(chains), 100.0);
+}
+
+/**
+ * A chain that repeats each sample has about half the effective samples
+ */
+TEST(MCMCs_MultiChain, Convergence_Autocorrelated) {
+  vector<vector<double>> draws = BuildChains(4, 1000, 0.0);
+  vector<vector<double>> chains(4, vector<double>(2000, 0.0));
+  for (unsigned c = 0; c < 4; ++c) {
+    for (unsigned i = 0; i < 2000; ++i)
+      chains[c][i] = draws[c][i / 2];
+  }
+
+  double ess = MultiChain::EffectiveSampleSize(chains);
+  EXPECT_GT(ess, 3000.0);
+  EXPECT_LT(ess, 5000.0);
+}
+
+/**
+ * The first half of each chain is burn-in and the
+ * chains are truncated to the shortest chain
+ */
+TEST(MCMCs_MultiChain, CalculateConvergence) {
+  vector<vector<double>> draws = BuildChains(2, 400, 0.0);
+  vector<mcmc::ChainLink> chain1(400);
+  vector<mcmc::ChainLink> chain2(300);
+  for (unsigned i = 0; i < 400; ++i) {
+    chain1[i].values_ = { draws[0][i], 2.0 };
+    if (i < 300)
+      chain2[i].values_ = { draws[1][i], 2.0 };
+  }
+  // a burn-in sample that would dominate the variance if it were used
+  chain1[0].values_[0] = 1000.0;
+
+  vector<mcmc::Convergence> convergence = MultiChain::CalculateConvergence({ &chain1, &chain2 }, { "a", "b" });
+  ASSERT_EQ(2u, convergence.size());
+  EXPECT_EQ("a", convergence[0].parameter_);
+  EXPECT_LT(convergence[0].r_hat_, 1.1);
+  EXPECT_EQ("b", convergence[1].parameter_);
+  EXPECT_DOUBLE_EQ(1.0, convergence[1].r_hat_);
+  EXPECT_DOUBLE_EQ(300.0, convergence[1].effective_sample_size_);
+}
+
+/**
+ * Run three chains of the two sex model starting from an MPD file
+ * and check each chain has run and the diagnostics have been calculated
+ */
+TEST_F(InternalEmptyModel, MCMCs_MultiChain_TwoSex) {
+  AddConfigurationLine(testcases::test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.mcmc_chains_     = 3;
+  parameters.threads_         = 2;
+  parameters.skip_estimation_ = true;
+  model_->global_configuration().set_run_parameters(parameters);
+
+  std::ofstream mpd("mpd.out");
+  mpd << "* MPD\n";
+  mpd << "estimate_values:\n";
+  mpd << "catchability[CPUEq].q process[Recruitment].R0 selectivity[FishingSel].a50 selectivity[FishingSel].ato95\n";
+  mpd << "0.000153139 997386 8 3\n";
+  mpd << "covariance_matrix:\n";
+  mpd << "1e-10 0 0 0\n";
+  mpd << "0 1e10 0 0\n";
+  mpd << "0 0 0.25 0\n";
+  mpd << "0 0 0 0.25\n";
+  mpd.close();
+
+  EXPECT_TRUE(model_->Start(RunMode::kMCMC));
+  std::remove("mpd.out");
+
+  MCMC* mcmc = model_->managers().mcmc()->active_mcmc();
+  EXPECT_EQ(100u, mcmc->chain().size());
+  EXPECT_EQ(100u, mcmc->link_count());
+
+  const vector<mcmc::Convergence>& convergence = mcmc->convergence();
+  ASSERT_EQ(4u, convergence.size());
+  EXPECT_EQ("catchability[CPUEq].q", convergence[0].parameter_);
+  EXPECT_EQ("selectivity[FishingSel].ato95", convergence[3].parameter_);
+  for (auto& parameter : convergence) {
+    EXPECT_GT(parameter.r_hat_, 0.0);
+    EXPECT_GT(parameter.effective_sample_size_, 0.0);
+  }
+
+  for (string file_name : { "mcmc_objectives.out", "mcmc_samples.out", "mcmc_convergence.out" }) {
+    std::remove(file_name.c_str());
+    for (unsigned chain = 1; chain <= 3; ++chain)
+      std::remove((file_name + ".chain" + std::to_string(chain)).c_str());
+  }
+}
+
+/**
+ * A single chain does not need the convergence diagnostics so the links
+ * are only streamed to the reports and the chain is not kept
+ */
+TEST_F(InternalEmptyModel, MCMCs_SingleChain_Streams_Links) {
+  AddConfigurationLine(testcases::test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.skip_estimation_ = true;
+  model_->global_configuration().set_run_parameters(parameters);
+
+  std::ofstream mpd("mpd.out");
+  mpd << "* MPD\n";
+  mpd << "estimate_values:\n";
+  mpd << "catchability[CPUEq].q process[Recruitment].R0 selectivity[FishingSel].a50 selectivity[FishingSel].ato95\n";
+  mpd << "0.000153139 997386 8 3\n";
+  mpd << "covariance_matrix:\n";
+  mpd << "1e-10 0 0 0\n";
+  mpd << "0 1e10 0 0\n";
+  mpd << "0 0 0.25 0\n";
+  mpd << "0 0 0 0.25\n";
+  mpd.close();
+
+  EXPECT_TRUE(model_->Start(RunMode::kMCMC));
+  std::remove("mpd.out");
+
+  MCMC* mcmc = model_->managers().mcmc()->active_mcmc();
+  EXPECT_FALSE(mcmc->keep_chain());
+  EXPECT_EQ(0u, mcmc->chain().size());
+  EXPECT_EQ(100u, mcmc->link_count());
+  EXPECT_EQ(4u, mcmc->last_link().values_.size());
+  EXPECT_LT(0u, mcmc->last_link().iteration_);
+
+  for (string file_name : { "mcmc_objectives.out", "mcmc_samples.out" })
+    std::remove(file_name.c_str());
+}
+
+} /* namespace mcmcs */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,268 @@
+/**
+ * @file MultiChain.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "MultiChain.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <thread>
+
+#include "Estimates/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "MCMCs/Manager.h"
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "Reports/Manager.h"
+#include "Utilities/Parallel.h"
+#include "Utilities/RandomNumberGenerator.h"
+#include "Utilities/To.h"
+
+// namespaces
+namespace niwa {
+namespace mcmcs {
+
+namespace {
+/**
+ * Calculate the mean of each chain, the within-chain variance (W)
+ * and the pooled variance estimate var+ from Gelman et al. (2013) BDA3.
+ */
+void ChainVariances(const vector<vector<double>>& chains, vector<double>& means, double& within, double& pooled) {
+  unsigned m = chains.size();
+  unsigned n = chains[0].size();
+
+  means.assign(m, 0.0);
+  double grand_mean = 0.0;
+  within = 0.0;
+  for (unsigned c = 0; c < m; ++c) {
+    for (double value : chains[c])
+      means[c] += value;
+    means[c] /= n;
+    grand_mean += means[c] / m;
+
+    double variance = 0.0;
+    for (double value : chains[c])
+      variance += (value - means[c]) * (value - means[c]);
+    within += variance / (n - 1) / m;
+  }
+
+  double between = 0.0;
+  for (unsigned c = 0; c < m; ++c)
+    between += (means[c] - grand_mean) * (means[c] - grand_mean);
+  between = m > 1 ? between * n / (m - 1) : 0.0;
+
+  pooled = (double(n - 1) / n) * within + between / n;
+}
+}
+
+/**
+ * Default constructor
+ *
+ * @param model The model loaded from the command line, this runs the first chain
+ */
+MultiChain::MultiChain(Model* model) : model_(model) {
+  chain_count_ = model_->global_configuration().mcmc_chains();
+  chain_models_.resize(chain_count_);
+}
+
+/**
+ * Destructor
+ */
+MultiChain::~MultiChain() {
+}
+
+/**
+ * Run each of our chains on the thread pool then
+ * calculate the convergence diagnostics across them
+ */
+void MultiChain::Execute() {
+  unsigned threads = utilities::Parallel::ThreadCount(model_->global_configuration().threads(), chain_count_);
+  LOG_MEDIUM() << "Running " << chain_count_ << " MCMC chains using " << threads << " threads";
+
+  reports::Manager* report_manager = model_->managers().report();
+  string original_suffix = report_manager->report_suffix();
+  report_manager->set_report_suffix(ChainSuffix(0));
+
+  utilities::Parallel::For(chain_count_, threads, [this](unsigned chain) { RunChain(chain); });
+
+  report_manager->set_report_suffix(original_suffix);
+
+  vector<const vector<mcmc::ChainLink>*> chains;
+  chains.push_back(&model_->managers().mcmc()->active_mcmc()->chain());
+  for (unsigned i = 1; i < chain_count_; ++i)
+    chains.push_back(&chain_models_[i]->managers().mcmc()->active_mcmc()->chain());
+
+  vector<string> parameters;
+  for (auto estimate : model_->managers().estimate()->GetIsEstimated())
+    parameters.push_back(estimate->parameter());
+
+  model_->managers().mcmc()->active_mcmc()->set_convergence(CalculateConvergence(chains, parameters));
+}
+
+/**
+ * Run a single chain. This is called from the thread pool.
+ *
+ * @param chain The index of the chain (0 is the main model)
+ */
+void MultiChain::RunChain(unsigned chain) {
+  if (chain == 0) {
+    LOG_FINE() << "Begin MCMC chain 1";
+    model_->managers().mcmc()->active_mcmc()->Execute();
+    return;
+  }
+
+  Model* chain_model = BuildChainModel(chain);
+  reports::Manager* report_manager = chain_model->managers().report();
+  std::thread report_thread([report_manager]() { report_manager->FlushReports(); });
+
+  LOG_FINE() << "Begin MCMC chain " << chain + 1;
+  bool success = chain_model->Start(RunMode::kMCMC);
+
+  report_manager->StopThread();
+  report_thread.join();
+
+  if (!success)
+    LOG_FATAL() << "MCMC chain " << chain + 1 << " failed to run";
+}
+
+/**
+ * Build a new model for a chain from the configuration lines that
+ * were loaded for our main model. The chain will skip estimation and
+ * start from the MPD.
+ *
+ * @param chain The index of the chain
+ * @return The new model, owned by this object
+ */
+Model* MultiChain::BuildChainModel(unsigned chain) {
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.mcmc_chains_     = 1;
+  parameters.skip_estimation_ = true;
+  parameters.keep_mcmc_chain_ = true;
+  chain_models_[chain] = model_->CreateWorker(parameters);
+
+  Model* chain_model = chain_models_[chain].get();
+  chain_model->managers().report()->set_report_suffix(ChainSuffix(chain));
+  chain_model->random_number_generator().Split(chain);
+  return chain_model;
+}
+
+/**
+ * @param chain The index of the chain
+ * @return The report suffix for the chain, e.g. .chain2
+ */
+string MultiChain::ChainSuffix(unsigned chain) const {
+  return ".chain" + utilities::ToInline<unsigned, string>(chain + 1);
+}
+
+/**
+ * Calculate the R-hat and effective sample size for each parameter. The first
+ * half of each chain is treated as burn-in and ignored, and the chains are
+ * truncated to the length of the shortest chain.
+ *
+ * @param chains The chains to compare
+ * @param parameters The label for each value in the chain links
+ * @return The diagnostics for each parameter
+ */
+vector<mcmc::Convergence> MultiChain::CalculateConvergence(const vector<const vector<mcmc::ChainLink>*>& chains, const vector<string>& parameters) {
+  vector<mcmc::Convergence> result;
+  if (chains.size() == 0)
+    return result;
+
+  unsigned length = chains[0]->size();
+  for (auto chain : chains)
+    length = std::min(length, (unsigned)chain->size());
+  unsigned burn_in = length / 2;
+
+  vector<vector<double>> values(chains.size(), vector<double>(length - burn_in, 0.0));
+  for (unsigned p = 0; p < parameters.size(); ++p) {
+    for (unsigned c = 0; c < chains.size(); ++c) {
+      for (unsigned i = burn_in; i < length; ++i)
+        values[c][i - burn_in] = AS_DOUBLE((*chains[c])[i].values_[p]);
+    }
+
+    mcmc::Convergence convergence;
+    convergence.parameter_             = parameters[p];
+    convergence.r_hat_                 = RHat(values);
+    convergence.effective_sample_size_ = EffectiveSampleSize(values);
+    result.push_back(convergence);
+  }
+
+  return result;
+}
+
+/**
+ * Calculate the potential scale reduction factor (R-hat)
+ *
+ * @param chains The values of a single parameter for each chain, all the same length
+ * @return R-hat, 1.0 if the parameter does not vary
+ */
+double MultiChain::RHat(const vector<vector<double>>& chains) {
+  if (chains.size() == 0 || chains[0].size() < 2)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  vector<double> means;
+  double within = 0.0;
+  double pooled = 0.0;
+  ChainVariances(chains, means, within, pooled);
+  if (within <= 0.0)
+    return pooled <= 0.0 ? 1.0 : std::numeric_limits<double>::infinity();
+
+  return sqrt(pooled / within);
+}
+
+/**
+ * Calculate the effective sample size across all chains using the
+ * combined autocorrelation and Geyer's initial positive sequence.
+ *
+ * @param chains The values of a single parameter for each chain, all the same length
+ * @return The effective sample size
+ */
+double MultiChain::EffectiveSampleSize(const vector<vector<double>>& chains) {
+  if (chains.size() == 0 || chains[0].size() < 4)
+    return std::numeric_limits<double>::quiet_NaN();
+
+  unsigned m = chains.size();
+  unsigned n = chains[0].size();
+  vector<double> means;
+  double within = 0.0;
+  double pooled = 0.0;
+  ChainVariances(chains, means, within, pooled);
+  if (pooled <= 0.0)
+    return m * n;
+
+  auto autocorrelation = [&](unsigned lag) {
+    double autocovariance = 0.0;
+    for (unsigned c = 0; c < m; ++c) {
+      double sum = 0.0;
+      for (unsigned i = 0; i + lag < n; ++i)
+        sum += (chains[c][i] - means[c]) * (chains[c][i + lag] - means[c]);
+      autocovariance += sum / n / m;
+    }
+    return 1.0 - (within - autocovariance) / pooled;
+  };
+
+  // Sum pairs of autocorrelations while they stay positive, keeping them monotone
+  double tau = -1.0;
+  double previous_pair = std::numeric_limits<double>::max();
+  for (unsigned lag = 0; lag + 1 < n; lag += 2) {
+    double pair = (lag == 0 ? 1.0 : autocorrelation(lag)) + autocorrelation(lag + 1);
+    if (pair <= 0.0)
+      break;
+    pair = std::min(pair, previous_pair);
+    tau += 2.0 * pair;
+    previous_pair = pair;
+  }
+
+  return (m * n) / std::max(tau, 1.0 / std::log10((double)m * n));
+}
+
+} /* namespace mcmcs */
+} /* namespace niwa */
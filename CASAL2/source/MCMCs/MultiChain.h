@@ -0,0 +1,71 @@
+/**
+ * @file MultiChain.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This class runs multiple independent MCMC chains in parallel (--chains).
+ *
+ * The first chain is run by the model that was loaded from the command line.
+ * Each additional chain gets its own Model built from the same configuration
+ * lines, so no model objects are shared between threads. Every chain
+ * starts from the MPD (mpd.out) like a --skip-estimation run, draws from
+ * its own random number stream (the chain index) and writes its reports
+ * with a .chainN suffix. The first chain uses the master stream so it
+ * matches a single chain run with the same seed.
+ *
+ * Once all chains have finished the R-hat and effective sample size are
+ * calculated for each estimate and stored on the MCMC of the main model
+ * for the mcmc_convergence report.
+ */
+#ifndef SOURCE_MCMCS_MULTICHAIN_H_
+#define SOURCE_MCMCS_MULTICHAIN_H_
+
+// headers
+#include <memory>
+#include <vector>
+
+#include "MCMCs/MCMC.h"
+
+// namespaces
+namespace niwa {
+class Model;
+
+namespace mcmcs {
+using std::vector;
+
+/**
+ * Class definition
+ */
+class MultiChain {
+public:
+  // methods
+  MultiChain() = delete;
+  explicit MultiChain(Model* model);
+  virtual                     ~MultiChain();
+  void                        Execute();
+
+  // static methods
+  static vector<mcmc::Convergence> CalculateConvergence(const vector<const vector<mcmc::ChainLink>*>& chains, const vector<string>& parameters);
+  static double               RHat(const vector<vector<double>>& chains);
+  static double               EffectiveSampleSize(const vector<vector<double>>& chains);
+
+private:
+  // methods
+  void                        RunChain(unsigned chain);
+  Model*                      BuildChainModel(unsigned chain);
+  string                      ChainSuffix(unsigned chain) const;
+
+  // members
+  Model*                      model_ = nullptr;
+  unsigned                    chain_count_ = 1;
+  vector<std::unique_ptr<Model>> chain_models_;
+};
+
+} /* namespace mcmcs */
+} /* namespace niwa */
+#endif /* SOURCE_MCMCS_MULTICHAIN_H_ */
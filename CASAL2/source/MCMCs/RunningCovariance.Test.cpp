@@ -0,0 +1,79 @@
+/**
+ * @file RunningCovariance.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "RunningCovariance.h"
+
+#include <cmath>
+#include <gtest/gtest.h>
+
+#include "Utilities/RandomNumberGenerator.h"
+
+// namespaces
+namespace niwa {
+namespace mcmc {
+
+/**
+ * Check the running covariance matches the two pass calculation
+ * the MCMC used to do over the whole chain
+ */
+TEST(MCMC, RunningCovariance_Matches_Two_Pass) {
+  utilities::RandomNumberGenerator rng;
+  rng.Reset(2468u);
+
+  const unsigned n_params = 4;
+  const unsigned n_iter = 500;
+  vector<vector<Double>> chain(n_iter, vector<Double>(n_params, 0.0));
+  for (auto& values : chain) {
+    values[0] = rng.normal(10.0, 2.0);
+    values[1] = values[0] * 0.5 + rng.normal(0.0, 1.0);
+    values[2] = rng.lognormal(1.0, 0.3);
+    values[3] = 1e6 + rng.normal(0.0, 1e-2);
+  }
+
+  RunningCovariance running;
+  running.Reset(n_params);
+  for (auto& values : chain)
+    running.Add(values);
+  ASSERT_EQ(n_iter, running.count());
+
+  for (unsigned i = 0; i < n_params; ++i) {
+    double mean_i = 0.0;
+    for (auto& values : chain)
+      mean_i += values[i];
+    mean_i /= n_iter;
+    EXPECT_NEAR(mean_i, running.mean()[i], 1e-9 * std::abs(mean_i));
+
+    for (unsigned j = 0; j <= i; ++j) {
+      double mean_j = 0.0;
+      for (auto& values : chain)
+        mean_j += values[j];
+      mean_j /= n_iter;
+
+      double sxy = 0.0;
+      for (auto& values : chain)
+        sxy += (values[i] - mean_i) * (values[j] - mean_j);
+      double expected = sxy / (n_iter - 1);
+      // relative to the standard deviations as the cross terms can be close to 0
+      double tolerance = 1e-8 * std::sqrt(running.covariance(i, i) * running.covariance(j, j));
+      EXPECT_NEAR(expected, running.covariance(i, j), tolerance) << i << ", " << j;
+      EXPECT_DOUBLE_EQ(running.covariance(i, j), running.covariance(j, i));
+    }
+  }
+
+  running.Reset(n_params);
+  EXPECT_EQ(0u, running.count());
+  EXPECT_DOUBLE_EQ(0.0, running.mean()[0]);
+}
+
+} /* namespace mcmc */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,66 @@
+/**
+ * @file RunningCovariance.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "RunningCovariance.h"
+
+#include <utility>
+
+// namespaces
+namespace niwa {
+namespace mcmc {
+
+/**
+ * Forget every value that has been added
+ *
+ * @param size The number of values in each link
+ */
+void RunningCovariance::Reset(unsigned size) {
+  size_  = size;
+  count_ = 0;
+  mean_.assign(size_, 0.0);
+  delta_.assign(size_, 0.0);
+  co_moments_.assign(size_ * (size_ + 1) / 2, 0.0);
+}
+
+/**
+ * Add the values from a link. The mean is updated first using the
+ * difference from the old mean and the co-moments then use the
+ * differences from the old and new means.
+ *
+ * @param values The values from the link, one for each parameter
+ */
+void RunningCovariance::Add(const vector<Double>& values) {
+  ++count_;
+  for (unsigned i = 0; i < size_; ++i) {
+    delta_[i] = values[i] - mean_[i];
+    mean_[i] += delta_[i] / count_;
+  }
+
+  Double* co_moment = co_moments_.data();
+  for (unsigned i = 0; i < size_; ++i) {
+    for (unsigned j = 0; j <= i; ++j, ++co_moment)
+      *co_moment += delta_[i] * (values[j] - mean_[j]);
+  }
+}
+
+/**
+ * @param i The row
+ * @param j The column
+ * @return The sample covariance (divided by count - 1) of the values added so far
+ */
+Double RunningCovariance::covariance(unsigned i, unsigned j) const {
+  if (j > i)
+    std::swap(i, j);
+  return co_moments_[i * (i + 1) / 2 + j] / (count_ - 1);
+}
+
+} /* namespace mcmc */
+} /* namespace niwa */
@@ -0,0 +1,58 @@
+/**
+ * @file RunningCovariance.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * Accumulates the mean and covariance of the values in the chain links
+ * one link at a time (Welford's online algorithm). The memory used
+ * depends only on the number of parameters so the MCMC can adapt its
+ * covariance matrix without keeping the chain.
+ */
+#ifndef SOURCE_MCMCS_RUNNINGCOVARIANCE_H_
+#define SOURCE_MCMCS_RUNNINGCOVARIANCE_H_
+
+// headers
+#include <vector>
+
+#include "Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace mcmc {
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * Class definition
+ */
+class RunningCovariance {
+public:
+  // methods
+  RunningCovariance() = default;
+  virtual                     ~RunningCovariance() = default;
+  void                        Reset(unsigned size);
+  void                        Add(const vector<Double>& values);
+  Double                      covariance(unsigned i, unsigned j) const;
+
+  // accessors
+  unsigned                    count() const { return count_; }
+  unsigned                    size() const { return size_; }
+  const vector<Double>&       mean() const { return mean_; }
+
+private:
+  // members
+  unsigned                    size_ = 0;
+  unsigned                    count_ = 0;
+  vector<Double>              mean_;
+  vector<Double>              delta_;
+  vector<Double>              co_moments_; // lower triangle, row i starts at i * (i + 1) / 2
+};
+
+} /* namespace mcmc */
+} /* namespace niwa */
+#endif /* SOURCE_MCMCS_RUNNINGCOVARIANCE_H_ */
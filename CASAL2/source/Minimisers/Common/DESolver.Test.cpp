@@ -0,0 +1,79 @@
+/**
+ * @file DESolver.Test.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ */
+#ifdef TESTMODE
+#ifndef USE_AUTODIFF
+
+// headers
+#include <chrono>
+#include <iostream>
+#include <memory>
+
+#include "Estimates/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+#include "TestResources/Models/TwoSexWithDeSolver.h"
+
+namespace niwa {
+namespace minimisers {
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * The two sex model with a smaller synchronous differential evolution population
+ */
+string two_sex_with_synchronous_de_solver() {
+  string configuration = testresources::models::two_sex_with_de_solver;
+  string population = "population_size 50\nmax_generations 1000\n";
+  size_t position = configuration.find(population);
+  if (position != string::npos)
+    configuration.replace(position, population.size(), "population_size 24\nmax_generations 20\nsynchronous true\n");
+  return configuration;
+}
+
+/**
+ * The trial solutions of each generation are drawn before they are scored so
+ * the synchronous solver must finish at the same solution no matter how many
+ * threads score them
+ */
+TEST_F(InternalEmptyModel, Minimisers_DESolver_Synchronous_Threads) {
+  AddConfigurationLine(two_sex_with_synchronous_de_solver(), "TestResources/Models/TwoSexWithDeSolver.h", 28);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.threads_ = 1;
+  model_->global_configuration().set_run_parameters(parameters);
+  parameters.threads_ = 4;
+  std::unique_ptr<Model> threaded_model = model_->CreateWorker(parameters);
+
+  auto start = std::chrono::steady_clock::now();
+  model_->Start(RunMode::kEstimation);
+  auto serial_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  threaded_model->Start(RunMode::kEstimation);
+  auto threaded_elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+  EXPECT_EQ(model_->objective_function().score(), threaded_model->objective_function().score());
+  vector<Estimate*> estimates = model_->managers().estimate()->objects();
+  vector<Estimate*> threaded_estimates = threaded_model->managers().estimate()->objects();
+  ASSERT_EQ(estimates.size(), threaded_estimates.size());
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    EXPECT_EQ(estimates[i]->value(), threaded_estimates[i]->value()) << estimates[i]->parameter();
+
+  std::cout << "[ BENCHMARK] synchronous de_solver: " << serial_elapsed << " ms on 1 thread, " << threaded_elapsed << " ms on 4 threads" << std::endl;
+  RecordProperty("serial_milliseconds", (int)serial_elapsed);
+  RecordProperty("threaded_milliseconds", (int)threaded_elapsed);
+}
+
+} /* namespace minimisers */
+} /* namespace niwa */
+#endif /* USE_AUTODIFF */
+#endif /* TESTMODE */
@@ -17,6 +17,9 @@
 #include "Estimates/Manager.h"
 #include "Minimisers/Common/DESolver/CallBack.h"
 #include "EstimateTransformations/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "Reports/Manager.h"
+#include "Utilities/Parallel.h"
 
 // Namespaces
 namespace niwa {
@@ -32,6 +35,7 @@ DESolver::DESolver(Model* model) : Minimiser(model) {
   parameters_.Bind<unsigned>(PARAM_MAX_GENERATIONS, &max_generations_, "The maximum number of iterations to run", "");
   parameters_.Bind<Double>(PARAM_TOLERANCE, &tolerance_, "The total variance between the population and best candidate before acceptance", "", 0.01);
   parameters_.Bind<string>(PARAM_METHOD, &method_, "The type of candidate generation method to use", "not_yet_implemented", "");
+  parameters_.Bind<bool>(PARAM_SYNCHRONOUS, &synchronous_, "Build the trial solutions of a generation from the previous generation so they can be scored in parallel (--threads)", "", false);
 }
 
 /**
@@ -44,8 +48,41 @@ void DESolver::DoValidate() {
   }
 }
 
+/**
+ * Build one worker model for each thread. The workers are only built
+ * once, they are brought up to date with our estimates each time the
+ * minimiser is executed.
+ *
+ * @param threads The number of threads (and worker models) to use
+ */
+void DESolver::BuildWorkers(unsigned threads) {
+  if (workers_.size() == threads)
+    return;
+
+  LOG_MEDIUM() << "Building " << threads << " models to score the differential evolution population";
+  utilities::RunParameters run_parameters = model_->global_configuration().run_parameters();
+  run_parameters.threads_ = 1;
+  workers_.resize(threads);
+
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    if (workers_[thread])
+      return;
+
+    workers_[thread] = model_->CreateWorker(run_parameters);
+    if (!workers_[thread]->Prepare(RunMode::kEstimation))
+      LOG_FATAL() << "Failed to build the model for differential evolution thread " << thread + 1;
+    // The output from building the model has already been written by us
+    workers_[thread]->managers().report()->TakeQueue();
+  });
+}
+
 /**
  * Execute our DE Solver minimiser engine
+ *
+ * When synchronous the trial solutions of each generation are scored on
+ * worker models, one per thread. The trial solutions are still drawn
+ * from our random number generator before they are scored so the result
+ * does not depend on the number of threads.
  */
 void DESolver::Execute() {
   estimates::Manager& estimate_manager = *model_->managers().estimate();
@@ -54,6 +91,17 @@ void DESolver::Execute() {
   vector<double>  upper_bounds;
   vector<double>  start_values;
 
+  vector<Model*> workers;
+  unsigned threads = synchronous_ ? utilities::Parallel::ThreadCount(model_->global_configuration().threads(), population_size_) : 1;
+  if (threads > 1) {
+    BuildWorkers(threads);
+    for (auto& worker : workers_) {
+      model_->CopyEstimateValues(*worker);
+      worker->managers().estimate_transformation()->TransformEstimates();
+      workers.push_back(worker.get());
+    }
+  }
+
   model_->managers().estimate_transformation()->TransformEstimates();
   vector<Estimate*> estimates = estimate_manager.GetIsEstimated();
   for (Estimate* estimate : estimates) {
@@ -74,8 +122,9 @@ void DESolver::Execute() {
   }
 
   // Setup Engine
-  desolver::CallBack solver = desolver::CallBack(model_, start_values.size(), population_size_, tolerance_);
+  desolver::CallBack solver = desolver::CallBack(model_, start_values.size(), population_size_, tolerance_, workers);
   solver.Setup(start_values, lower_bounds, upper_bounds, kBest1Exp, difference_scale_, crossover_probability_);
+  solver.set_synchronous(synchronous_);
 
   // Solver
   if (solver.Solve(max_generations_)) {
@@ -86,8 +135,13 @@ void DESolver::Execute() {
     LOG_FINE() << "DE Solver has failed to converge";
   }
 
-  model_->managers().estimate_transformation()->RestoreEstimates();
+  // The trial solutions were scored on the workers, so finish with our model at the best solution
+  if (synchronous_)
+    solver.EnergyFunction(solver.best_solution());
 
+  model_->managers().estimate_transformation()->RestoreEstimates();
+  for (Model* worker : workers)
+    worker->managers().estimate_transformation()->RestoreEstimates();
 }
 
 } /* namespace minimisers */
@@ -21,6 +21,8 @@
 #define MINIMISERS_DESOLVER_H_
 
 // Headers
+#include <memory>
+
 #include "Minimisers/Minimiser.h"
 
 // Namespaces
@@ -41,6 +43,9 @@ public:
   void                        Execute() override final;
 
 private:
+  // Methods
+  void                        BuildWorkers(unsigned threads);
+
   // Members
   unsigned                    population_size_;
   double                      crossover_probability_;
@@ -48,6 +53,8 @@ private:
   unsigned                    max_generations_;
   double                      tolerance_;
   string                      method_;
+  bool                        synchronous_;
+  vector<std::unique_ptr<Model>> workers_;
 };
 
 } /* namespace minimisers */
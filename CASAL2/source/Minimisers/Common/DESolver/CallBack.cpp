@@ -14,22 +14,67 @@
 // Headers
 #include <Minimisers/Common/DESolver/CallBack.h>
 
+#include <atomic>
+#include <deque>
+
 #include "Estimates/Manager.h"
 #include "EstimateTransformations/Manager.h"
 #include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Logging/Logging.h"
+#include "Reports/Manager.h"
+#include "Utilities/Parallel.h"
 
 // Namespaces
 namespace niwa {
 namespace minimisers {
 namespace desolver {
 
+namespace {
+/**
+ * Score a test solution on a model
+ *
+ * @param model The model to run
+ * @param test_solution The values of the enabled estimates
+ * @return The objective function score
+ */
+double Evaluate(Model& model, const vector<double>& test_solution) {
+  vector<Estimate*> estimates = model.managers().estimate()->GetIsEstimated();
+
+  if (test_solution.size() != estimates.size()) {
+    LOG_CODE_ERROR() << "The number of enabled estimates does not match the number of test solution values";
+  }
+
+  for (unsigned i = 0; i < test_solution.size(); ++i)
+    estimates[i]->set_value(test_solution[i]);
+
+  ObjectiveFunction& objective = model.objective_function();
+  if (objective.LoadCachedScore())
+    return objective.score();
+
+  model.managers().estimate_transformation()->RestoreEstimates();
+  model.FullIteration();
+
+  objective.CalculateScore();
+  objective.CacheScore();
+
+  model.managers().estimate_transformation()->TransformEstimates();
+  return objective.score();
+}
+}
+
 /**
  * Default constructor
+ *
+ * @param model The model to minimise
+ * @param vector_size The number of enabled estimates
+ * @param population_size The number of candidate solutions in the population
+ * @param tolerance The tolerance threshold before convergance
+ * @param workers Worker models to score the trial solutions of a generation on (synchronous only)
  */
-CallBack::CallBack(Model* model, unsigned vector_size, unsigned population_size, double tolerance)
-  : niwa::minimisers::desolver::Engine(vector_size, population_size, tolerance),
-  model_(model) {
+CallBack::CallBack(Model* model, unsigned vector_size, unsigned population_size, double tolerance, vector<Model*> workers)
+  : niwa::minimisers::desolver::Engine(vector_size, population_size, tolerance, model->random_number_generator()),
+  model_(model),
+  workers_(workers) {
 }
 
 /**
@@ -46,23 +91,36 @@ CallBack::~CallBack() {
  * @return The score from the energy function
  */
 double CallBack::EnergyFunction(vector<double> test_solution) {
-  vector<Estimate*> estimates = model_->managers().estimate()->GetIsEstimated();
+  return Evaluate(*model_, test_solution);
+}
 
-  if (test_solution.size() != estimates.size()) {
-    LOG_CODE_ERROR() << "The number of enabled estimates does not match the number of test solution values";
+/**
+ * Score the trial solutions of a generation. With worker models each
+ * worker takes the next trial solution until all have been scored.
+ *
+ * @param test_solutions The trial solutions to score
+ * @param energies The score of each trial solution
+ */
+void CallBack::EnergyFunctions(const vector<vector<double>>& test_solutions, vector<double>& energies) {
+  if (workers_.size() == 0) {
+    Engine::EnergyFunctions(test_solutions, energies);
+    return;
   }
 
-  for (unsigned i = 0; i < test_solution.size(); ++i)
-    estimates[i]->set_value(test_solution[i]);
-
-  model_->managers().estimate_transformation()->RestoreEstimates();
-  model_->FullIteration();
+  // Report output from the workers is written in the same order as it would be by a single thread
+  vector<std::deque<reports::Manager::QueuedOutput>> outputs(test_solutions.size());
+  std::atomic<unsigned> next_solution(0);
 
-  ObjectiveFunction& objective = model_->objective_function();
-  objective.CalculateScore();
+  utilities::Parallel::For(workers_.size(), workers_.size(), [&](unsigned thread) {
+    Model& worker = *workers_[thread];
+    for (unsigned i = next_solution++; i < test_solutions.size(); i = next_solution++) {
+      energies[i] = Evaluate(worker, test_solutions[i]);
+      outputs[i] = worker.managers().report()->TakeQueue();
+    }
+  });
 
-  model_->managers().estimate_transformation()->TransformEstimates();
-  return objective.score();
+  for (auto& output : outputs)
+    model_->managers().report()->Enqueue(output);
 }
 
 } /* namespace desolver */
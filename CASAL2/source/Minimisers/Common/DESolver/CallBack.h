@@ -33,13 +33,15 @@ namespace desolver {
 class CallBack : public niwa::minimisers::desolver::Engine {
 public:
   // Methods
-  CallBack(Model* model, unsigned vector_size, unsigned population_size, double tolerance);
+  CallBack(Model* model, unsigned vector_size, unsigned population_size, double tolerance, vector<Model*> workers = vector<Model*>());
   virtual                     ~CallBack();
   double                      EnergyFunction(vector<double> test_solution) override final;
+  void                        EnergyFunctions(const vector<vector<double>>& test_solutions, vector<double>& energies) override final;
 
 private:
   // Members
   Model*                    model_;
+  vector<Model*>            workers_;
 };
 
 } /* namespace desolver */
@@ -35,8 +35,10 @@ namespace compare = niwa::utilities::doublecompare;
  * @param vector_size The size of our vectors with candidate bounds
  * @param population_size The starting population size
  * @param tolerance The tolerance threshold before convergance
+ * @param rng The random number generator to draw the population from
  */
-Engine::Engine(unsigned vector_size, unsigned population_size, double tolerance) {
+Engine::Engine(unsigned vector_size, unsigned population_size, double tolerance, utilities::RandomNumberGenerator& rng)
+  : rng_(rng) {
   vector_size_      = vector_size;
   population_size_  = population_size;
   generations_      = 0;
@@ -138,11 +140,9 @@ void Engine::Setup(vector<double> start_values, vector<double> lower_bounds,
   scale_        = diff_scale;
   probability_  = crossover_prob;
 
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-
   for (unsigned i = 0; i < population_size_; ++i) {
     for (unsigned j = 0; j < vector_size_; ++j)
-      population_[i][j] = rng.uniform(lower_bounds[j], upper_bounds[j]);
+      population_[i][j] = rng_.uniform(lower_bounds[j], upper_bounds[j]);
 
     population_energy_[i] = 1e20;
   }
@@ -180,36 +180,34 @@ bool Engine::Solve(unsigned max_generations) {
 
   for (unsigned i = 0; i < max_generations; ++i) {
     LOG_MEDIUM() << "DESolver: current generation: " << (i+1) << "\n";
-    for (unsigned j = 0; j < population_size_; ++j) {
-      // Build our Trial Solution
-      (this->*calculate_solution_)(j);
-
-      trial_energy_ = EnergyFunction(current_values_);
-      if (trial_energy_ < population_energy_[j]) {
-        // Copy solution to our Population
-        population_energy_[j] = trial_energy_;
-        population_[j].assign(current_values_.begin(), current_values_.end());
+    if (synchronous_) {
+      /**
+       * Build every trial solution from the previous generation before any
+       * of them are scored, so the whole generation can be scored at once
+       */
+      vector<vector<double>> trial_solutions(population_size_);
+      for (unsigned j = 0; j < population_size_; ++j) {
+        (this->*calculate_solution_)(j);
+        trial_solutions[j] = current_values_;
+      }
 
-        // Is this a new all-time low for our search?
-        if (trial_energy_ < best_energy_) {
+      vector<double> trial_energies(population_size_, 0.0);
+      EnergyFunctions(trial_solutions, trial_energies);
+      for (unsigned j = 0; j < population_size_; ++j) {
+        if (Select(j, trial_solutions[j], trial_energies[j]))
           new_best_energy = true;
-          // Copy the solution to our best.
-          best_energy_ = trial_energy_;
-          best_solution_.assign(current_values_.begin(), current_values_.end());
-
+      }
 
-          LOG_MEDIUM() << "Objective function value: " << trial_energy_;
+    } else {
+      for (unsigned j = 0; j < population_size_; ++j) {
+        // Build our Trial Solution
+        (this->*calculate_solution_)(j);
 
-//          if(!(pConfig->getQuietMode())) {
-//            LOG_MEDIUM() << "Current estimates: ";
-//            for (int k = 0; k < (int)vBestSolution.size(); ++k)
-//              LOG_MEDIUM() << vBestSolution[k] << " ";
-//            LOG_MEDIUM();
-//            LOG_MEDIUM() << "Objective function value: " << dTrialEnergy << "\n";
-//          }
-        }
-      }
-    } // end for()
+        trial_energy_ = EnergyFunction(current_values_);
+        if (Select(j, current_values_, trial_energy_))
+          new_best_energy = true;
+      } // end for()
+    }
 
     // If we have a new Best, lets generate a gradient.
     if (new_best_energy)
@@ -238,6 +236,46 @@ bool Engine::Solve(unsigned max_generations) {
   return false;
 }
 
+/**
+ * Score each of the trial solutions. The solutions are independent of each
+ * other so this can be overridden to score them at the same time.
+ *
+ * @param test_solutions The trial solutions to score
+ * @param energies The score of each trial solution (must be the same size)
+ */
+void Engine::EnergyFunctions(const vector<vector<double>>& test_solutions, vector<double>& energies) {
+  for (unsigned i = 0; i < test_solutions.size(); ++i)
+    energies[i] = EnergyFunction(test_solutions[i]);
+}
+
+/**
+ * Replace a member of the population with its trial solution if the
+ * trial solution has a lower energy
+ *
+ * @param candidate The member of the population the trial solution was built for
+ * @param trial_solution The trial solution
+ * @param trial_energy The energy of the trial solution
+ * @return True if the trial solution is a new all-time low for our search
+ */
+bool Engine::Select(unsigned candidate, const vector<double>& trial_solution, double trial_energy) {
+  if (trial_energy >= population_energy_[candidate])
+    return false;
+
+  // Copy solution to our Population
+  population_energy_[candidate] = trial_energy;
+  population_[candidate].assign(trial_solution.begin(), trial_solution.end());
+
+  // Is this a new all-time low for our search?
+  if (trial_energy >= best_energy_)
+    return false;
+
+  // Copy the solution to our best.
+  best_energy_ = trial_energy;
+  best_solution_.assign(trial_solution.begin(), trial_solution.end());
+  LOG_MEDIUM() << "Objective function value: " << trial_energy;
+  return true;
+}
+
 /**
  *
  */
@@ -359,14 +397,12 @@ void Engine::CondAssign(double &res, const double &cond, const double &arg) {
  * Select some population indexes to use for the next candidate
  */
 void Engine::SelectSamples(unsigned candidate) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-
   double population_size = population_size_ * 1.0;
 
   // Build first Sample
   if (number_of_parents_ >= 1) {
     do {
-      r1_ = rng.uniform(0.0, population_size);
+      r1_ = rng_.uniform(0.0, population_size);
     } while (r1_ == candidate);
   } else
     return;
@@ -374,7 +410,7 @@ void Engine::SelectSamples(unsigned candidate) {
   // Build Second Sample
   if (number_of_parents_ >= 2) {
     do {
-      r2_ = (int) rng.uniform(0.0, population_size);
+      r2_ = (int) rng_.uniform(0.0, population_size);
     } while ((r2_ == candidate) || (r2_ == r1_));
   } else
     return;
@@ -382,7 +418,7 @@ void Engine::SelectSamples(unsigned candidate) {
   // Build third sample
   if (number_of_parents_ >= 3) {
     do {
-      r3_ = rng.uniform(0.0, population_size);
+      r3_ = rng_.uniform(0.0, population_size);
     } while ((r3_ == candidate) || (r3_ == r2_) || (r3_ == r1_));
   } else
     return;
@@ -390,14 +426,14 @@ void Engine::SelectSamples(unsigned candidate) {
   // etc
   if (number_of_parents_ >= 4) {
     do {
-      r4_ = rng.uniform(0.0, population_size);
+      r4_ = rng_.uniform(0.0, population_size);
     } while ((r4_ == candidate) || (r4_ == r3_) || (r4_ == r2_) || (r4_ == r1_));
   }
 
   // etc
   if (number_of_parents_ >= 5) {
     do {
-      r5_ = rng.uniform(0.0, population_size);
+      r5_ = rng_.uniform(0.0, population_size);
     } while ((r5_ == candidate) || (r5_ == r4_) || (r5_ == r3_) || (r5_ == r2_) || (r5_ == r1_));
   }
 
@@ -409,7 +445,6 @@ void Engine::SelectSamples(unsigned candidate) {
 // Generate A Solution from our Best Score
 //**********************************************************************
 void Engine::Best1Exp(unsigned candidate) {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
 
   // Select our Previous Generations to Sample From
   SelectSamples(candidate);
@@ -420,7 +455,7 @@ void Engine::Best1Exp(unsigned candidate) {
   // Generate new values for our Current by using probability and scale and then
   // making a slight adjustment to the vBestSolution.
   for (unsigned i = 0; i < vector_size_; ++i) {
-    if (rng.uniform() < probability_) {
+    if (rng_.uniform() < probability_) {
       current_values_[i] = best_solution_[i] + (scale_ * (population_[r1_][i] - population_[r2_][i]));
 
       if (current_values_[i] < lower_bounds_[i])
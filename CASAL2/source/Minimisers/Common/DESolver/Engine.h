@@ -28,6 +28,7 @@
 #include <map>
 #include <vector>
 
+#include "Utilities/RandomNumberGenerator.h"
 #include "Utilities/Types.h"
 
 // Namespaces
@@ -58,18 +59,24 @@ typedef void (minimisers::desolver::Engine::*StrategyFunction)(unsigned);
  */
 class Engine {
 public:
-  Engine(unsigned vector_size, unsigned population_size, double tolerance);
+  Engine(unsigned vector_size, unsigned population_size, double tolerance, utilities::RandomNumberGenerator& rng);
   virtual                     ~Engine();
   void                        Setup(vector<double> start_values, vector<double> lower_bounds,
                                   vector<double> upper_bounds, int de_strategy, double diff_scale,
                                   double crossover_prob);
   virtual bool                Solve(unsigned max_generations);
   virtual double              EnergyFunction(vector<double> test_solution) = 0;
+  virtual void                EnergyFunctions(const vector<vector<double>>& test_solutions, vector<double>& energies);
+
+  // Accessors
+  const vector<double>&       best_solution() const { return best_solution_; }
+  void                        set_synchronous(bool synchronous) { synchronous_ = synchronous; }
 
 private:
   // Methods
   void                        SelectSamples(unsigned candidate);
   bool                        GenerateGradient();
+  bool                        Select(unsigned candidate, const vector<double>& trial_solution, double trial_energy);
   void                        ScaleValues();
   void                        UnScaleValues();
   double                      ScaleValue(double value, double min, double max);
@@ -113,6 +120,8 @@ private:
   double                      step_size_;
   double                      penalty_;
   double                      tolerance_;
+  bool                        synchronous_ = false;
+  utilities::RandomNumberGenerator& rng_;
 };
 
 } /* namespace desolver */
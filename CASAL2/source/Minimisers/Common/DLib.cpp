@@ -55,12 +55,16 @@ const column_vector DLib::DLibCalculateGradient(const column_vector& estimate_or
     estimates[j]->set_value(value);
   }
 
-  model_->managers().estimate_transformation()->RestoreEstimates();
-  model_->FullIteration();
+  // The line search has normally just run the model at this point
+  if (!objective.LoadCachedScore()) {
+    model_->managers().estimate_transformation()->RestoreEstimates();
+    model_->FullIteration();
 
-  objective.CalculateScore();
+    objective.CalculateScore();
+    objective.CacheScore();
 
-  model_->managers().estimate_transformation()->TransformEstimates();
+    model_->managers().estimate_transformation()->TransformEstimates();
+  }
   Double original_score = objective.score();
 //  cout << "os + p: " << objective.score() << " + " << penalty << endl;
 
@@ -86,12 +90,15 @@ const column_vector DLib::DLibCalculateGradient(const column_vector& estimate_or
         estimates[j]->set_value(value);
       }
 
-      model_->managers().estimate_transformation()->RestoreEstimates();
-      model_->FullIteration();
+      if (!objective.LoadCachedScore()) {
+        model_->managers().estimate_transformation()->RestoreEstimates();
+        model_->FullIteration();
 
-      objective.CalculateScore();
+        objective.CalculateScore();
+        objective.CacheScore();
 
-      model_->managers().estimate_transformation()->TransformEstimates();
+        model_->managers().estimate_transformation()->TransformEstimates();
+      }
       plus_eps = objective.score(); // + penalty;
 
       /**
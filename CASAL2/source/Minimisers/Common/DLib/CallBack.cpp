@@ -48,11 +48,15 @@ Double Callback::operator()(const ::dlib::matrix<double, 0, 1>& Parameters) cons
     estimates[i]->set_value(value);
   }
 
+  ObjectiveFunction& objective = model_->objective_function();
+  if (objective.LoadCachedScore())
+    return objective.score() + penalty;
+
   model_->managers().estimate_transformation()->RestoreEstimates();
   model_->FullIteration();
   LOG_MEDIUM() << "Iteration Complete";
-  ObjectiveFunction& objective = model_->objective_function();
   objective.CalculateScore();
+  objective.CacheScore();
 
   model_->managers().estimate_transformation()->TransformEstimates();
   double score = objective.score() + penalty;
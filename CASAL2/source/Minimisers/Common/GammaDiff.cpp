@@ -16,6 +16,9 @@
 
 #include "Estimates/Manager.h"
 #include "EstimateTransformations/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "Reports/Manager.h"
+#include "Utilities/Parallel.h"
 
 // namespaces
 namespace niwa {
@@ -29,6 +32,37 @@ GammaDiff::GammaDiff(Model* model) : Minimiser(model) {
   parameters_.Bind<int>(PARAM_MAX_EVALUATIONS, &max_evaluations_, "Maximum number of evaluations", "", 4000);
   parameters_.Bind<Double>(PARAM_TOLERANCE, &gradient_tolerance_, "Tolerance of the gradient for convergence", "", 0.02);
   parameters_.Bind<Double>(PARAM_STEP_SIZE, &step_size_, "Minimum Step-size before minimisation fails", "", 1e-7);
+  parameters_.Bind<bool>(PARAM_CENTRAL_DIFFERENCES, &central_differences_, "Use central differences instead of forward differences for the gradient", "", false);
+}
+
+/**
+ * Build one worker model for each thread. The workers are only built
+ * once, they are brought up to date with our estimates each time the
+ * minimiser is executed.
+ *
+ * @param threads The number of threads (and worker models) to use
+ */
+void GammaDiff::BuildWorkers(unsigned threads) {
+  if (workers_.size() == threads)
+    return;
+
+  LOG_MEDIUM() << "Building " << threads << " models for the numerical differences gradient";
+  utilities::RunParameters run_parameters = model_->global_configuration().run_parameters();
+  run_parameters.threads_ = 1;
+  workers_.resize(threads);
+  worker_call_backs_.resize(threads);
+
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    if (workers_[thread])
+      return;
+
+    workers_[thread] = model_->CreateWorker(run_parameters);
+    if (!workers_[thread]->Prepare(RunMode::kEstimation))
+      LOG_FATAL() << "Failed to build the model for numerical differences thread " << thread + 1;
+    // The output from building the model has already been written by us
+    workers_[thread]->managers().report()->TakeQueue();
+    worker_call_backs_[thread].reset(new gammadiff::CallBack(workers_[thread].get()));
+  });
 }
 
 /**
@@ -47,6 +81,17 @@ void GammaDiff::Execute() {
   vector<double>  upper_bounds;
   vector<double>  start_values;
 
+  vector<gammadiff::CallBack*> worker_call_backs;
+  unsigned threads = utilities::Parallel::ThreadCount(model_->global_configuration().threads(), estimate_manager->GetIsEstimatedCount());
+  if (threads > 1) {
+    BuildWorkers(threads);
+    for (unsigned i = 0; i < threads; ++i) {
+      model_->CopyEstimateValues(*workers_[i]);
+      workers_[i]->managers().estimate_transformation()->TransformEstimates();
+      worker_call_backs.push_back(worker_call_backs_[i].get());
+    }
+  }
+
   model_->managers().estimate_transformation()->TransformEstimates();
   vector<Estimate*> estimates = estimate_manager->GetIsEstimated();
   LOG_FINE() << "estimates.size(): " << estimates.size();
@@ -77,9 +122,11 @@ void GammaDiff::Execute() {
   clGammaDiff.optimise_finite_differences(call_back,
       start_values, lower_bounds, upper_bounds,
       status, max_iterations_, max_evaluations_, gradient_tolerance_,
-      hessian_,1,step_size_);
+      hessian_,1,step_size_, central_differences_, worker_call_backs);
 
   model_->managers().estimate_transformation()->RestoreEstimates();
+  for (unsigned i = 0; i < worker_call_backs.size(); ++i)
+    workers_[i]->managers().estimate_transformation()->RestoreEstimates();
 
   switch(status) {
     case -1:
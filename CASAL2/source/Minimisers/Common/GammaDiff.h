@@ -11,6 +11,11 @@
  *
  * This minimiser is a deterministic numerical differences minimisers
  *
+ * When more than one thread is available the finite difference
+ * gradient is evaluated on worker models, one per thread. The workers
+ * are built the first time the minimiser is executed and are kept for
+ * the later estimation phases.
+ *
  * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
  */
 #ifndef USE_AUTODIFF
@@ -18,7 +23,10 @@
 #define MINIMISERS_GAMMADIFF_H_
 
 // headers
+#include <memory>
+
 #include "Minimisers/Minimiser.h"
+#include "Minimisers/Common/GammaDiff/Callback.h"
 
 // namespaces
 namespace niwa {
@@ -39,11 +47,17 @@ public:
   void                        Execute() override final;
 
 private:
+  // Methods
+  void                        BuildWorkers(unsigned threads);
+
   // Members
   int                         max_iterations_;
   int                         max_evaluations_;
   double                      gradient_tolerance_;
   double                      step_size_;
+  bool                        central_differences_;
+  vector<std::unique_ptr<Model>> workers_;
+  vector<std::unique_ptr<gammadiff::CallBack>> worker_call_backs_;
 };
 
 } /* namespace minimisers */
@@ -46,11 +46,15 @@ double CallBack::operator()(const vector<double>& Parameters) {
   for (unsigned i = 0; i < Parameters.size(); ++i)
     estimates[i]->set_value(Parameters[i]);
 
+  ObjectiveFunction& objective = model_->objective_function();
+  if (objective.LoadCachedScore())
+    return objective.score();
+
   model_->managers().estimate_transformation()->RestoreEstimates();
   model_->FullIteration();
 
-  ObjectiveFunction& objective = model_->objective_function();
   objective.CalculateScore();
+  objective.CacheScore();
 
   model_->managers().estimate_transformation()->TransformEstimates();
   return objective.score();
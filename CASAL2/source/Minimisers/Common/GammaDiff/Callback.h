@@ -38,6 +38,9 @@ public:
   virtual                     ~CallBack() = default;
   double                      operator()(const vector<double>& Parameters);
 
+  // accessors
+  Model*                      model() const { return model_; }
+
 private:
   Model*                    model_;
 };
@@ -15,10 +15,15 @@
 #include <Minimisers/Common/GammaDiff/Engine.h>
 
 #include <math.h>
+#include <atomic>
+#include <deque>
 #include <iomanip>
 
 #include <Minimisers/Common/GammaDiff/FMM.h>
+#include "Model/Managers.h"
+#include "Reports/Manager.h"
 #include "Utilities/DoubleCompare.h"
+#include "Utilities/Parallel.h"
 
 // namespaces
 namespace niwa {
@@ -56,7 +61,7 @@ void Engine::condAssign(double &res, const double &cond, const double &arg) {
 // double Engine::boundp(const double& xx, double fmin, double fmax, double& fpen) {
 // Boundary Pin
 //**********************************************************************
-double Engine::unScaleValue(const double& value, double min, double max) {
+double Engine::unScaleValue(const double& value, double min, double max, double& penalty) {
   // courtesy of AUTODIF - modified to correct error -
   // penalty on values outside [-1,1] multiplied by 100 as of 14/1/02.
   double t = 0.0;
@@ -64,13 +69,13 @@ double Engine::unScaleValue(const double& value, double min, double max) {
 
   t = min + (max - min) * (sin(value * 1.57079633) + 1) / 2;
   this->condAssign(y, -.9999 - value, (value + .9999) * (value + .9999), 0);
-  dPenalty += y;
+  penalty += y;
   this->condAssign(y, value - .9999, (value - .9999) * (value - .9999), 0);
-  dPenalty += y;
+  penalty += y;
   this->condAssign(y, -1 - value, 1e5 * (value + 1) * (value + 1), 0);
-  dPenalty += y;
+  penalty += y;
   this->condAssign(y, value - 1, 1e5 * (value - 1) * (value - 1), 0);
-  dPenalty += y;
+  penalty += y;
 
   return (t);
 }
@@ -119,7 +124,105 @@ void Engine::buildCurrentValues() {
     if (dc::IsEqual(vLowerBounds[i], vUpperBounds[i]))
       vCurrentValues[i] = vLowerBounds[i];
     else
-      vCurrentValues[i] = unScaleValue(vScaledValues[i], vLowerBounds[i], vUpperBounds[i]);
+      vCurrentValues[i] = unScaleValue(vScaledValues[i], vLowerBounds[i], vUpperBounds[i], dPenalty);
+  }
+}
+
+//**********************************************************************
+// long double Engine::evaluateScaledValues(gammadiff::CallBack& objective, const vector<double>& vTestScaledValues)
+// Evaluate the objective (plus bound penalty) at a set of scaled values.
+// This does not change any of our members so it can be called from
+// several threads at once with different objectives.
+//**********************************************************************
+long double Engine::evaluateScaledValues(gammadiff::CallBack& objective, const vector<double>& vTestScaledValues) {
+  double          dTestPenalty = 0.0;
+  vector<double>  vTestValues(vTestScaledValues.size());
+
+  for (int i = 0; i < (int)vTestScaledValues.size(); ++i) {
+    if (dc::IsEqual(vLowerBounds[i], vUpperBounds[i]))
+      vTestValues[i] = vLowerBounds[i];
+    else
+      vTestValues[i] = unScaleValue(vTestScaledValues[i], vLowerBounds[i], vUpperBounds[i], dTestPenalty);
+  }
+
+  long double dScoreI = objective(vTestValues);
+  dScoreI += dTestPenalty;
+  return dScoreI;
+}
+
+//**********************************************************************
+// void Engine::buildGradient(gammadiff::CallBack& objective, vector<gammadiff::CallBack*>& vWorkerObjectives,
+//   double dScore, double dStepSize, bool bCentralDifferences)
+// Build the finite difference gradient. Each variable is moved by the step
+// size on its own (and the other way as well for central differences).
+// The evaluations do not depend on each other, so when we have worker
+// objectives they are shared out between them. Otherwise they are run in
+// order on our own objective. The gradient is the same either way.
+//**********************************************************************
+void Engine::buildGradient(gammadiff::CallBack& objective, vector<gammadiff::CallBack*>& vWorkerObjectives,
+    double dScore, double dStepSize, bool bCentralDifferences) {
+
+  unsigned          iEvaluationsPerVariable = bCentralDifferences ? 2 : 1;
+  vector<int>       vVariables;
+  vector<double>    vTestValues;
+
+  // Work out the value each variable is moved to
+  for (int i = 0; i < (int)vScaledValues.size(); ++i) {
+    if (dc::IsEqual(vLowerBounds[i], vUpperBounds[i])) {
+      vGradientValues[i] = 0.0;
+      continue;
+    }
+
+    long double dStepSizeI  = dStepSize * ((vScaledValues[i] > 0) ? 1 : -1);
+    long double dOrigValue  = vScaledValues[i];
+    double      dForward    = vScaledValues[i] + dStepSizeI;
+
+    vVariables.push_back(i);
+    vTestValues.push_back(dForward);
+    if (bCentralDifferences)
+      vTestValues.push_back(dOrigValue - (dForward - dOrigValue));
+  }
+
+  vector<long double> vScores(vTestValues.size(), 0.0);
+  auto evaluate = [&](gammadiff::CallBack& callback, unsigned k) {
+    vector<double> vTestScaledValues(vScaledValues);
+    vTestScaledValues[vVariables[k / iEvaluationsPerVariable]] = vTestValues[k];
+    vScores[k] = evaluateScaledValues(callback, vTestScaledValues);
+  };
+
+  if (vWorkerObjectives.size() == 0) {
+    for (unsigned k = 0; k < vTestValues.size(); ++k)
+      evaluate(objective, k);
+
+  } else {
+    // Report output from the workers is written in the same order as it would be by a single thread
+    vector<std::deque<reports::Manager::QueuedOutput>> vOutputs(vTestValues.size());
+    std::atomic<unsigned> iNextEvaluation(0);
+
+    utilities::Parallel::For(vWorkerObjectives.size(), vWorkerObjectives.size(), [&](unsigned thread) {
+      gammadiff::CallBack& callback = *vWorkerObjectives[thread];
+      for (unsigned k = iNextEvaluation++; k < vTestValues.size(); k = iNextEvaluation++) {
+        evaluate(callback, k);
+        vOutputs[k] = callback.model()->managers().report()->TakeQueue();
+      }
+    });
+
+    for (auto& output : vOutputs)
+      objective.model()->managers().report()->Enqueue(output);
+  }
+
+  // Populate Gradient
+  for (unsigned v = 0; v < vVariables.size(); ++v) {
+    int i = vVariables[v];
+    long double dOrigValue = vScaledValues[i];
+
+    if (bCentralDifferences) {
+      long double dStepSizeI = (long double)vTestValues[v * 2] - vTestValues[v * 2 + 1];
+      vGradientValues[i] = (vScores[v * 2] - vScores[v * 2 + 1]) / dStepSizeI;
+    } else {
+      long double dStepSizeI = vTestValues[v] - dOrigValue;
+      vGradientValues[i] = (vScores[v] - dScore) / dStepSizeI;
+    }
   }
 }
 
@@ -131,7 +234,8 @@ void Engine::buildCurrentValues() {
 //**********************************************************************
 double Engine::optimise_finite_differences(gammadiff::CallBack& objective, vector<double>& StartValues, vector<double>& LowerBounds,
     vector<double>& UpperBounds, int& convergence, int& iMaxIter, int& iMaxFunc, double dGradTol,
-    double **pOptimiseHessian, int untransformedHessians, double dStepSize) {
+    double **pOptimiseHessian, int untransformedHessians, double dStepSize, bool bCentralDifferences,
+    vector<gammadiff::CallBack*>& vWorkerObjectives) {
 
   // Variables
   int       iVectorSize   = (int)StartValues.size();
@@ -176,39 +280,10 @@ double Engine::optimise_finite_differences(gammadiff::CallBack& objective, vecto
     }
 
     // Gradient Required
-    // This will loop through each variable changing it once
-    // to see how the other variables change.
-    // There-by generating our co-variance
+    // This will move each variable on its own to see
+    // how the objective function changes
     if (clMinimiser.getResult() >= 1) { // 1 = Gradient Required
-      long double dOrigValue;
-      long double dStepSizeI;
-      long double dScoreI;
-
-      for (int i = 0; i < iVectorSize; ++i) {
-        if (dc::IsEqual(vLowerBounds[i], vUpperBounds[i])) {
-          vGradientValues[i] = 0.0;
-
-        } else {
-          // Workout how much to change the variable by
-          dStepSizeI  = dStepSize * ((vScaledValues[i] > 0) ? 1 : -1);
-
-          // Backup Orig Value, and Assign New Var
-          dOrigValue        = vScaledValues[i];
-          vScaledValues[i]  += dStepSizeI;
-          dStepSizeI        = vScaledValues[i] - dOrigValue;
-
-          dPenalty = 0.0;
-          buildCurrentValues();
-
-          dScoreI = objective(vCurrentValues);
-          dScoreI += dPenalty;
-
-          // Populate Gradient, and Restore Orig Value
-          vGradientValues[i]  = (dScoreI - dScore) / dStepSizeI;
-          vScaledValues[i]    = dOrigValue;
-        }
-      }
-      // Gradient Finished
+      buildGradient(objective, vWorkerObjectives, dScore, dStepSize, bCentralDifferences);
     }
     // Call our Function Minimiser
     clMinimiser.fMin(vScaledValues, dScore, vGradientValues);
@@ -225,7 +300,7 @@ double Engine::optimise_finite_differences(gammadiff::CallBack& objective, vecto
   }
 
   for (int i = 0; i < iVectorSize; ++i) {
-    vCurrentValues[i] = unScaleValue(vScaledValues[i], vLowerBounds[i], vUpperBounds[i]);
+    vCurrentValues[i] = unScaleValue(vScaledValues[i], vLowerBounds[i], vUpperBounds[i], dPenalty);
   }
 
   for (int i = 0; i < iVectorSize; ++i) {
@@ -32,7 +32,8 @@ public:
   virtual                     ~Engine();
   double optimise_finite_differences(gammadiff::CallBack& objective, vector<double>& StartValues, vector<double>& LowerBounds,
       vector<double>& UpperBounds, int& convergence, int& iMaxIter, int& iMaxFunc, double dGradTol,
-      double **pOptimiseHessian, int untransformedHessians, double dStepSize);
+      double **pOptimiseHessian, int untransformedHessians, double dStepSize, bool bCentralDifferences,
+      vector<gammadiff::CallBack*>& vWorkerObjectives);
 
 private:
   // Variables
@@ -47,8 +48,11 @@ private:
   // Functions
   void                        buildScaledValues();
   void                        buildCurrentValues();
+  void                        buildGradient(gammadiff::CallBack& objective, vector<gammadiff::CallBack*>& vWorkerObjectives,
+                                  double dScore, double dStepSize, bool bCentralDifferences);
+  long double                 evaluateScaledValues(gammadiff::CallBack& objective, const vector<double>& vTestScaledValues);
   double                      scaleValue(double value, double min, double max);
-  double                      unScaleValue(const double& value, double min, double max);
+  double                      unScaleValue(const double& value, double min, double max, double& penalty);
   void                        condAssign(double &res, const double &cond, const double &arg1, const double &arg2);
   void                        condAssign(double &res, const double &cond, const double &arg);
 };
@@ -25,6 +25,7 @@
 #include "Estimates/Manager.h"
 #include "Logging/Logging.h"
 #include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Utilities/DoubleCompare.h"
 
 // Namespaces
@@ -41,6 +42,7 @@ Minimiser::Minimiser(Model* model) : model_(model) {
   parameters_.Bind<string>(PARAM_TYPE, &type_, "The type of minimiser to use", "");
   parameters_.Bind<bool>(PARAM_ACTIVE, &active_, "Indicates if this minimiser is active", "", false);
   parameters_.Bind<bool>(PARAM_COVARIANCE, &build_covariance_, "Indicates if a covariance matrix should be generated", "", true);
+  parameters_.Bind<unsigned>(PARAM_OBJECTIVE_CACHE_SIZE, &objective_cache_size_, "The number of objective function scores to keep so points the minimiser has already evaluated are not run again (0 to disable)", "", 64u);
 
   hessian_ = 0;
   hessian_size_ = 0;
@@ -82,6 +84,9 @@ void Minimiser::Build() {
       hessian_[i][j] = 0.0;
   }
 
+  if (active_)
+    model_->objective_function().set_cache_size(objective_cache_size_);
+
   DoBuild();
 }
 
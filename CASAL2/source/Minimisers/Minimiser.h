@@ -41,6 +41,22 @@ enum Type {
 };
 } /* namespace MinimiserResult */
 
+namespace minimiser {
+/**
+ * Struct definition for the result of one start when
+ * estimating from multiple starting points (--starts)
+ */
+struct StartResult {
+  unsigned              start_ = 0;
+  Double                score_ = 0.0;
+  MinimiserResult::Type result_ = MinimiserResult::kInvalid;
+  bool                  converged_ = false;
+  unsigned              optimum_ = 0; // 1 is the lowest converged optimum, 0 if the start did not converge
+  bool                  best_ = false;
+  vector<Double>        values_;
+};
+} /* namespace minimiser */
+
 /**
  * Class Definition
  */
@@ -69,6 +85,11 @@ public:
   double**                    hessian_matrix() const { return hessian_; }
   unsigned                    hessian_size() const { return hessian_size_; }
   MinimiserResult::Type       result() const { return result_; }
+  unsigned                    objective_cache_size() const { return objective_cache_size_; }
+  const vector<minimiser::StartResult>& start_results() const { return start_results_; }
+  const vector<string>&       start_parameters() const { return start_parameters_; }
+  void                        set_start_results(const vector<string>& parameters, const vector<minimiser::StartResult>& results) {
+    start_parameters_ = parameters; start_results_ = results; }
 
 protected:
   // Members
@@ -77,10 +98,13 @@ protected:
   double**                    hessian_ = nullptr;
   unsigned                    hessian_size_;
   bool                        build_covariance_;
+  unsigned                    objective_cache_size_ = 0;
   ublas::matrix<double>       covariance_matrix_;
   ublas::matrix<double>       correlation_matrix_;
   MinimiserResult::Type       result_ = MinimiserResult::kInvalid;
   vector<Double>              gradient_;
+  vector<string>              start_parameters_;
+  vector<minimiser::StartResult> start_results_;
 };
 } /* namespace niwa */
 #endif /* MINIMISER_H_ */
@@ -0,0 +1,201 @@
+/**
+ * @file Checkpoint.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "Checkpoint.h"
+
+#include <sstream>
+
+#include "DerivedQuantities/DerivedQuantity.h"
+#include "DerivedQuantities/Manager.h"
+#include "Estimates/Manager.h"
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
+#include "Partition/Partition.h"
+#include "TestResources/TestCases/CasalComplex2.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+
+// Namespaces
+namespace niwa {
+
+using niwa::testfixtures::InternalEmptyModel;
+using niwa::testcases::test_cases_casal_complex_2;
+
+const std::string test_cases_checkpoint_ycs_estimates =
+R"(
+@estimate
+parameter process[recruitment].ycs_values{2000}
+type uniform
+lower_bound 0.1
+upper_bound 10
+
+@estimate
+parameter process[recruitment].ycs_values{1990}
+type uniform
+lower_bound 0.1
+upper_bound 10
+)";
+
+/**
+ * Check a checkpoint can be written to a stream and read back in
+ */
+TEST(Checkpoint, Serialise_And_Deserialise) {
+  Checkpoint checkpoint;
+  checkpoint.set_year(1995);
+  checkpoint.Save("value", Double(0.1));
+  checkpoint.Save("map", map<unsigned, Double>{ { 1990, 1.0 / 3.0 }, { 1991, 2.5 } });
+  checkpoint.Save("table", vector<vector<Double>>{ { 1.0, 2.0 }, { }, { 3.0 } });
+  checkpoint.Save("labels", vector<string>{ "male", "female" });
+
+  std::stringstream stream;
+  checkpoint.Serialise(stream);
+
+  Checkpoint restored;
+  ASSERT_TRUE(restored.Deserialise(stream));
+  EXPECT_EQ(1995u, restored.year());
+
+  Double value = 0.0;
+  restored.Restore("value", value);
+  EXPECT_DOUBLE_EQ(0.1, value);
+
+  map<unsigned, Double> values;
+  restored.Restore("map", values);
+  ASSERT_EQ(2u, values.size());
+  EXPECT_DOUBLE_EQ(1.0 / 3.0, values[1990]);
+  EXPECT_DOUBLE_EQ(2.5, values[1991]);
+
+  vector<vector<Double>> table;
+  restored.Restore("table", table);
+  ASSERT_EQ(3u, table.size());
+  ASSERT_EQ(2u, table[0].size());
+  EXPECT_EQ(0u, table[1].size());
+  ASSERT_EQ(1u, table[2].size());
+  EXPECT_DOUBLE_EQ(2.0, table[0][1]);
+  EXPECT_DOUBLE_EQ(3.0, table[2][0]);
+
+  vector<string> labels;
+  restored.Restore("labels", labels);
+  ASSERT_EQ(2u, labels.size());
+  EXPECT_EQ("female", labels[1]);
+}
+
+/**
+ * Change a year class strength and check resuming the model from the
+ * checkpoint gives the same answer as running the whole model again
+ */
+TEST_F(InternalEmptyModel, Checkpoint_Resume_Matches_FullIteration) {
+  AddConfigurationLine(test_cases_casal_complex_2, "CasalComplex2.h", 31);
+  AddConfigurationLine(test_cases_checkpoint_ycs_estimates, __FILE__, 33);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  Estimate* ycs_2000 = model_->managers().estimate()->GetEstimate("process[recruitment].ycs_values{2000}");
+  Estimate* ycs_1990 = model_->managers().estimate()->GetEstimate("process[recruitment].ycs_values{1990}");
+  ASSERT_NE(nullptr, ycs_2000);
+  ASSERT_NE(nullptr, ycs_1990);
+  DerivedQuantity* ssb = model_->managers().derived_quantity()->GetDerivedQuantity("ssb");
+  ObjectiveFunction& obj_function = model_->objective_function();
+  partition::Category& male = model_->partition().category("male");
+
+  model_->set_record_checkpoints(true);
+  model_->FullIteration();
+  vector<Double> original_numbers(male.data_.begin(), male.data_.end());
+  EXPECT_EQ(29u, model_->checkpoints().size());
+
+  // 2000 is not standardised so only its recruitment year is run again
+  ycs_2000->set_value(1.5);
+  EXPECT_EQ(2002u, model_->FirstChangedYear());
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  Double resumed_score = obj_function.score();
+  map<unsigned, Double> resumed_ssb = ssb->values();
+  vector<Double> resumed_numbers(male.data_.begin(), male.data_.end());
+  bool numbers_changed = false;
+  for (unsigned i = 0; i < original_numbers.size(); ++i)
+    numbers_changed = numbers_changed || AS_DOUBLE(original_numbers[i]) != AS_DOUBLE(resumed_numbers[i]);
+  EXPECT_TRUE(numbers_changed);
+
+  model_->set_record_checkpoints(false);
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  EXPECT_DOUBLE_EQ(AS_DOUBLE(obj_function.score()), AS_DOUBLE(resumed_score));
+  for (auto iter : ssb->values())
+    EXPECT_DOUBLE_EQ(AS_DOUBLE(iter.second), AS_DOUBLE(resumed_ssb[iter.first])) << "year " << iter.first;
+  for (unsigned i = 0; i < male.data_.size(); ++i)
+    EXPECT_DOUBLE_EQ(AS_DOUBLE(male.data_[i]), AS_DOUBLE(resumed_numbers[i])) << "age index " << i;
+
+  // 1990 is standardised so every year class changes
+  model_->set_record_checkpoints(true);
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  Double original_score = obj_function.score();
+  ycs_1990->set_value(2.0);
+  EXPECT_EQ(1975u, model_->FirstChangedYear());
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  resumed_score = obj_function.score();
+  EXPECT_NE(AS_DOUBLE(original_score), AS_DOUBLE(resumed_score));
+
+  model_->set_record_checkpoints(false);
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  EXPECT_DOUBLE_EQ(AS_DOUBLE(obj_function.score()), AS_DOUBLE(resumed_score));
+}
+
+/**
+ * Change estimates that are not inputs to the initialisation phases
+ * and check the cached initialisation gives the same answer as
+ * running the whole model again
+ */
+TEST_F(InternalEmptyModel, Checkpoint_Cached_Initialisation_Matches_FullIteration) {
+  AddConfigurationLine(test_cases_casal_complex_2, "CasalComplex2.h", 31);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  Estimate* q = model_->managers().estimate()->GetEstimate("catchability[chatTANbiomass.one].q");
+  Estimate* a50 = model_->managers().estimate()->GetEstimate("selectivity[chatTANselMale].a50");
+  Estimate* r0 = model_->managers().estimate()->GetEstimate("process[recruitment].r0");
+  ASSERT_NE(nullptr, q);
+  ASSERT_NE(nullptr, a50);
+  ASSERT_NE(nullptr, r0);
+  ObjectiveFunction& obj_function = model_->objective_function();
+
+  model_->set_record_checkpoints(true);
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  Double original_score = obj_function.score();
+  // only the state after initialisation is needed
+  EXPECT_EQ(1u, model_->checkpoints().size());
+
+  q->set_value(0.2);
+  a50->set_value(8.0);
+  EXPECT_EQ(1975u, model_->FirstChangedYear());
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  Double cached_score = obj_function.score();
+  EXPECT_NE(AS_DOUBLE(original_score), AS_DOUBLE(cached_score));
+  EXPECT_EQ(2002u + 1, model_->FirstChangedYear());
+
+  r0->set_value(4e6);
+  EXPECT_EQ(0u, model_->FirstChangedYear());
+  r0->set_value(5e6);
+
+  model_->set_record_checkpoints(false);
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  EXPECT_DOUBLE_EQ(AS_DOUBLE(obj_function.score()), AS_DOUBLE(cached_score));
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
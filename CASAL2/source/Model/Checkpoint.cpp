@@ -0,0 +1,210 @@
+/**
+ * @file Checkpoint.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "Checkpoint.h"
+
+#include <iomanip>
+#include <limits>
+
+#include "Logging/Logging.h"
+
+// namespaces
+namespace niwa {
+
+/**
+ * Save a map of values by year. The map is stored as
+ * year, value pairs in a single vector.
+ *
+ * @param key The key to store the values under
+ * @param values The values to store
+ */
+void Checkpoint::Save(const string& key, const map<unsigned, Double>& values) {
+  vector<Double>& stored = values_[key];
+  stored.clear();
+  stored.reserve(values.size() * 2);
+  for (auto iter : values) {
+    stored.push_back(Double(iter.first));
+    stored.push_back(iter.second);
+  }
+}
+
+/**
+ * Save a vector of vectors (e.g. values by initialisation phase). The
+ * number of rows and the size of each row are stored before the values.
+ *
+ * @param key The key to store the values under
+ * @param values The values to store
+ */
+void Checkpoint::Save(const string& key, const vector<vector<Double>>& values) {
+  vector<Double>& stored = values_[key];
+  stored.clear();
+  stored.push_back(Double(values.size()));
+  for (auto& row : values)
+    stored.push_back(Double(row.size()));
+  for (auto& row : values)
+    stored.insert(stored.end(), row.begin(), row.end());
+}
+
+/**
+ * Return the values stored under a key
+ *
+ * @param key The key the values were saved with
+ * @return The stored values
+ */
+const vector<Double>& Checkpoint::values(const string& key) const {
+  auto iter = values_.find(key);
+  if (iter == values_.end())
+    LOG_CODE_ERROR() << "The checkpoint does not contain any values for " << key;
+  return iter->second;
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, Double& value) const {
+  const vector<Double>& stored = values(key);
+  if (stored.size() != 1)
+    LOG_CODE_ERROR() << "The checkpoint holds " << stored.size() << " values for " << key << " not a single value";
+  value = stored[0];
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, unsigned& value) const {
+  Double stored = 0.0;
+  Restore(key, stored);
+  value = (unsigned)AS_DOUBLE(stored);
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, vector<Double>& values) const {
+  values = this->values(key);
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, map<unsigned, Double>& values) const {
+  const vector<Double>& stored = this->values(key);
+  values.clear();
+  for (unsigned i = 0; i + 1 < stored.size(); i += 2)
+    values[(unsigned)AS_DOUBLE(stored[i])] = stored[i + 1];
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, vector<vector<Double>>& values) const {
+  const vector<Double>& stored = this->values(key);
+  unsigned rows = stored.size() == 0 ? 0 : (unsigned)AS_DOUBLE(stored[0]);
+  values.resize(rows);
+  unsigned offset = rows + 1;
+  for (unsigned i = 0; i < rows; ++i) {
+    unsigned size = (unsigned)AS_DOUBLE(stored[i + 1]);
+    if (offset + size > stored.size())
+      LOG_CODE_ERROR() << "The checkpoint values for " << key << " are not the size they were saved with";
+    values[i].assign(stored.begin() + offset, stored.begin() + offset + size);
+    offset += size;
+  }
+}
+
+/**
+ *
+ */
+void Checkpoint::Restore(const string& key, vector<string>& labels) const {
+  auto iter = labels_.find(key);
+  if (iter == labels_.end())
+    LOG_CODE_ERROR() << "The checkpoint does not contain any labels for " << key;
+  labels = iter->second;
+}
+
+/**
+ * Write the checkpoint to a stream. Each key is written on its own line
+ * as: values|labels key count value_1 .. value_n
+ *
+ * @param stream The stream to write to
+ */
+void Checkpoint::Serialise(std::ostream& stream) const {
+  std::streamsize precision = stream.precision(std::numeric_limits<double>::max_digits10);
+  stream << "checkpoint " << year_ << "\n";
+  for (auto& iter : values_) {
+    stream << "values " << iter.first << " " << iter.second.size();
+    for (const Double& value : iter.second)
+      stream << " " << AS_DOUBLE(value);
+    stream << "\n";
+  }
+  for (auto& iter : labels_) {
+    stream << "labels " << iter.first << " " << iter.second.size();
+    for (const string& label : iter.second)
+      stream << " " << label;
+    stream << "\n";
+  }
+  stream << "end\n";
+  stream.precision(precision);
+}
+
+/**
+ * Read a checkpoint written by Serialise(). Anything already in
+ * this checkpoint is removed first.
+ *
+ * @param stream The stream to read from
+ * @return true if the checkpoint was read, false otherwise
+ */
+bool Checkpoint::Deserialise(std::istream& stream) {
+  Clear();
+
+  string token = "";
+  if (!(stream >> token >> year_) || token != "checkpoint") {
+    LOG_ERROR() << "The checkpoint could not be read because it does not start with a checkpoint line";
+    return false;
+  }
+
+  while (stream >> token && token != "end") {
+    string key = "";
+    unsigned count = 0;
+    if (!(stream >> key >> count)) {
+      LOG_ERROR() << "The checkpoint could not be read because the line starting with " << token << " is incomplete";
+      return false;
+    }
+
+    if (token == "values") {
+      vector<Double>& values = values_[key];
+      values.resize(count);
+      double value = 0.0;
+      for (unsigned i = 0; i < count && stream >> value; ++i)
+        values[i] = value;
+    } else if (token == "labels") {
+      vector<string>& labels = labels_[key];
+      labels.resize(count);
+      for (unsigned i = 0; i < count && stream >> labels[i]; ++i) { }
+    } else {
+      LOG_ERROR() << "The checkpoint could not be read because " << token << " is not a valid line type";
+      return false;
+    }
+
+    if (!stream) {
+      LOG_ERROR() << "The checkpoint could not be read because there are not enough values for " << key;
+      return false;
+    }
+  }
+
+  if (token != "end") {
+    LOG_ERROR() << "The checkpoint could not be read because it does not finish with end";
+    return false;
+  }
+  return true;
+}
+
+} /* namespace niwa */
@@ -0,0 +1,86 @@
+/**
+ * @file Checkpoint.h
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * A checkpoint holds a copy of the model state at the end of a year
+ * so the model can be taken back to that point without re-running
+ * the initialisation and the years before it.
+ *
+ * The state is the partition plus anything that changes as years are
+ * run: the values processes build up (e.g. the catches a mortality event
+ * has removed so far), derived quantities, observation comparisons,
+ * flagged penalties and projected parameters. Values are stored by key,
+ * normally the absolute name of the object that owns them
+ * (e.g. process[recruitment]), so each object only has to know how to
+ * save and restore its own members.
+ *
+ * A checkpoint only holds numbers and labels so it can be written to a
+ * stream with Serialise() and read back with Deserialise(), e.g. to keep
+ * it on disk or hand it to another model built from the same configuration.
+ */
+#ifndef SOURCE_MODEL_CHECKPOINT_H_
+#define SOURCE_MODEL_CHECKPOINT_H_
+
+// headers
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+
+using niwa::utilities::Double;
+using std::map;
+using std::string;
+using std::vector;
+
+/**
+ * Class definition
+ */
+class Checkpoint {
+public:
+  // methods
+  Checkpoint() = default;
+  virtual                     ~Checkpoint() = default;
+  void                        Clear() { values_.clear(); labels_.clear(); year_ = 0; }
+  void                        Save(const string& key, Double value) { values_[key].assign(1, value); }
+  void                        Save(const string& key, unsigned value) { values_[key].assign(1, Double(value)); }
+  void                        Save(const string& key, const vector<Double>& values) { values_[key] = values; }
+  void                        Save(const string& key, const map<unsigned, Double>& values);
+  void                        Save(const string& key, const vector<vector<Double>>& values);
+  void                        Save(const string& key, const vector<string>& labels) { labels_[key] = labels; }
+  void                        Restore(const string& key, Double& value) const;
+  void                        Restore(const string& key, unsigned& value) const;
+  void                        Restore(const string& key, vector<Double>& values) const;
+  void                        Restore(const string& key, map<unsigned, Double>& values) const;
+  void                        Restore(const string& key, vector<vector<Double>>& values) const;
+  void                        Restore(const string& key, vector<string>& labels) const;
+  void                        Serialise(std::ostream& stream) const;
+  bool                        Deserialise(std::istream& stream);
+
+  // accessors
+  bool                        empty() const { return values_.empty() && labels_.empty(); }
+  unsigned                    year() const { return year_; }
+  void                        set_year(unsigned year) { year_ = year; }
+  const vector<Double>&       values(const string& key) const;
+
+private:
+  // members
+  map<string, vector<Double>> values_;
+  map<string, vector<string>> labels_;
+  unsigned                    year_ = 0;
+};
+
+} /* namespace niwa */
+
+#endif /* SOURCE_MODEL_CHECKPOINT_H_ */
@@ -69,7 +69,7 @@ Managers::Managers(Model* model) {
   likelihood_             = new likelihoods::Manager();
   mcmc_                   = new mcmcs::Manager();
   minimiser_              = new minimisers::Manager();
-  observation_            = new observations::Manager();
+  observation_            = new observations::Manager(model_);
   penalty_                = new penalties::Manager();
   process_                = new processes::Manager();
   profile_                = new profiles::Manager();
@@ -13,7 +13,11 @@
 // Headers
 #include "Model.h"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <iostream>
+#include <mutex>
 #include <thread>
 #include <chrono>
 #include <boost/algorithm/string/replace.hpp>
@@ -25,27 +29,36 @@
 #include "Managers.h"
 #include "Objects.h"
 #include "Categories/Categories.h"
+#include "Checkpoint.h"
 #include "ConfigurationLoader/EstimableValuesLoader.h"
+#include "ConfigurationLoader/Loader.h"
 #include "ConfigurationLoader/MCMCObjective.h"
 #include "ConfigurationLoader/MCMCSample.h"
+#include "DerivedQuantities/Manager.h"
 #include "EquationParser/EquationParser.h"
 #include "Estimables/Estimables.h"
 #include "Estimates/Manager.h"
+#include "EstimateTransformations/Manager.h"
 #include "GlobalConfiguration/GlobalConfiguration.h"
 #include "InitialisationPhases/Manager.h"
 #include "Logging/Logging.h"
 #include "MCMCs/Manager.h"
+#include "MCMCs/MultiChain.h"
 #include "Minimisers/Manager.h"
 #include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Observations/Manager.h"
 #include "Partition/Accessors/Category.h"
 #include "Partition/Partition.h"
+#include "Penalties/Manager.h"
+#include "Processes/Manager.h"
 #include "Profiles/Manager.h"
 #include "Projects/Manager.h"
 #include "Reports/Manager.h"
 #include "Simulates/Manager.h"
 #include "TimeSteps/Manager.h"
 #include "TimeVarying/Manager.h"
+#include "TimeVarying/TimeVarying.h"
+#include "Utilities/Parallel.h"
 #include "Utilities/RandomNumberGenerator.h"
 #include "Utilities/To.h"
 
@@ -82,6 +95,7 @@ Model::Model() {
   partition_ = new Partition(this);
   objective_function_ = new ObjectiveFunction(this);
   equation_parser_ = new EquationParser(this);
+  random_number_generator_ = new utilities::RandomNumberGenerator();
 }
 
 /**
@@ -95,6 +109,7 @@ Model::~Model() {
   delete categories_;
   delete partition_;
   delete objective_function_;
+  delete random_number_generator_;
 }
 
 /**
@@ -162,6 +177,10 @@ EquationParser& Model::equation_parser() {
   return *equation_parser_;
 }
 
+utilities::RandomNumberGenerator& Model::random_number_generator() {
+  return *random_number_generator_;
+}
+
 /**
  * Start our model. This is the entry point method for the model
  * after being called from the main() method.
@@ -171,6 +190,62 @@ EquationParser& Model::equation_parser() {
  */
 bool Model::Start(RunMode::Type run_mode) {
   LOG_TRACE();
+  if (!Prepare(run_mode))
+    return false;
+
+  switch(run_mode_) {
+  case RunMode::kBasic:
+    RunBasic();
+    break;
+
+  case RunMode::kEstimation:
+    RunEstimation();
+    break;
+
+  case RunMode::kMCMC:
+    if (!RunMCMC())
+      return false;
+    break;
+
+  case RunMode::kProfiling:
+    RunProfiling();
+    break;
+
+  case RunMode::kSimulation:
+    RunSimulation();
+    break;
+
+  case RunMode::kProjection:
+    RunProjection();
+    break;
+
+  case RunMode::kTesting:
+    break;
+
+  default:
+    LOG_ERROR() << "Invalid run mode has been specified. This run mode is not supported: " << run_mode_;
+    break;
+  }
+
+  // finalise all reports
+  LOG_FINE() << "Finalising Reports";
+  state_ = State::kFinalise;
+  for (auto executor : executors_[state_])
+    executor->Execute();
+  managers_->report()->Execute(state_);
+  managers_->report()->Finalise();
+  return true;
+}
+
+/**
+ * Take the model from start up through validation, building and
+ * verification so it is ready to run in the given run mode. This is
+ * called by Start() and by models created to run work on other threads.
+ *
+ * @param run_mode The run mode the model will be run in
+ * @return true on success, false if there were errors
+ */
+bool Model::Prepare(RunMode::Type run_mode) {
   Logging& logging = Logging::Instance();
   if (logging.errors().size() > 0) {
     logging.FlushErrors();
@@ -219,49 +294,58 @@ bool Model::Start(RunMode::Type run_mode) {
   // prepare all reports
   LOG_FINE() << "Preparing Reports";
   managers_->report()->Prepare();
+  return true;
+}
 
-  switch(run_mode_) {
-  case RunMode::kBasic:
-    RunBasic();
-    break;
-
-  case RunMode::kEstimation:
-    RunEstimation();
-    break;
-
-  case RunMode::kMCMC:
-    if (!RunMCMC())
-      return false;
-    break;
-
-  case RunMode::kProfiling:
-    RunProfiling();
-    break;
-
-  case RunMode::kSimulation:
-    RunSimulation();
-    break;
-
-  case RunMode::kProjection:
-    RunProjection();
-    break;
-
-  case RunMode::kTesting:
-    break;
+/**
+ * Create a new model from the configuration lines that were loaded for
+ * this model so work can be run on another thread. The worker shares no
+ * objects with this model. Its random number generator uses the same seed
+ * as ours so it can be split in to the same streams.
+ *
+ * The worker has not been started. Call Prepare() or Start() on it.
+ *
+ * @param run_parameters The run parameters for the worker
+ * @return The new worker model
+ */
+std::unique_ptr<Model> Model::CreateWorker(utilities::RunParameters run_parameters) {
+  std::unique_ptr<Model> worker(new Model());
+  vector<string> command_line_parameters = global_configuration_->command_line_parameters();
+  worker->global_configuration().set_run_parameters(run_parameters);
+  worker->global_configuration().set_command_line_parameters(command_line_parameters);
+
+  configuration::Loader loader(*worker);
+  for (auto file_line : global_configuration_->config_file_lines())
+    loader.AddFileLine(file_line);
+  loader.ParseFileLines();
+
+  worker->global_configuration().ParseOptions(worker.get());
+  worker->random_number_generator().Reset(random_number_generator_->seed());
+  return worker;
+}
 
-  default:
-    LOG_ERROR() << "Invalid run mode has been specified. This run mode is not supported: " << run_mode_;
-    break;
+/**
+ * Copy the values of our estimates, and of the addressables loaded from
+ * an input (-i) file, to a worker created by CreateWorker(). Which
+ * estimates are estimated in the current phase is copied as well.
+ *
+ * This must be called before the estimates are transformed.
+ *
+ * @param worker The worker to copy the values to
+ */
+void Model::CopyEstimateValues(Model& worker) {
+  for (const string& label : managers_->estimables()->GetEstimables())
+    *worker.objects().GetAddressable(label) = *objects().GetAddressable(label);
+
+  vector<Estimate*> estimates = managers_->estimate()->objects();
+  vector<Estimate*> worker_estimates = worker.managers().estimate()->objects();
+  if (estimates.size() != worker_estimates.size())
+    LOG_CODE_ERROR() << "The worker has " << worker_estimates.size() << " estimates but we have " << estimates.size();
+
+  for (unsigned i = 0; i < estimates.size(); ++i) {
+    worker_estimates[i]->set_estimated(estimates[i]->estimated());
+    worker_estimates[i]->set_value(estimates[i]->value());
   }
-
-  // finalise all reports
-  LOG_FINE() << "Finalising Reports";
-  state_ = State::kFinalise;
-  for (auto executor : executors_[state_])
-    executor->Execute();
-  managers_->report()->Execute(state_);
-  managers_->report()->Finalise();
-  return true;
 }
 
 /**
@@ -423,8 +507,21 @@ void Model::RunBasic() {
   // Create an instance of all categories
   niwa::partition::accessors::All all_view(this);
 
+  // Run all but the last set of -i values on worker models
+  unsigned first_value = 0;
+  if (addressable_values_file_ && !single_step) {
+    unsigned threads = utilities::Parallel::ThreadCount(global_configuration_->threads(), adressable_values_count_ - 1);
+#ifdef USE_AUTODIFF
+    threads = 1; // the auto-differentiation tapes are not thread safe
+#endif
+    if (threads > 1) {
+      RunBasicWorkers(threads);
+      first_value = adressable_values_count_ - 1;
+    }
+  }
+
   // Model is about to run
-  for (unsigned i = 0; i < adressable_values_count_; ++i) {
+  for (unsigned i = first_value; i < adressable_values_count_; ++i) {
     if (addressable_values_file_) {
       estimables.LoadValues(i);
       Reset();
@@ -510,8 +607,10 @@ void Model::RunBasic() {
 
     managers_->observation()->CalculateScores();
 
-    for (auto executor : executors_[State::kExecute])
+    for (auto executor : executors_[State::kExecute]) {
+      Timings::Timer timer(timings_, executor, nullptr, Timings::Method::kExecute);
       executor->Execute();
+    }
 
     // Model has finished so we can run finalise.
 
@@ -521,6 +620,98 @@ void Model::RunBasic() {
   }
 }
 
+/**
+ * Run the sets of values in the -i file on worker models, one per thread
+ * (--threads). We run the last set ourselves afterwards so the model is in
+ * the same state at the end of the run as it would be with a single thread.
+ *
+ * The rows of the file are read one at a time as the workers ask for them.
+ * The output of each row is handed to our report writer in row order,
+ * including the output tabular reports hold until they are finalised.
+ * A worker cannot take a row more than 4 rows per thread ahead of the
+ * output that has been handed over, so only a few rows of values and
+ * output are held in memory at once.
+ *
+ * @param threads The number of threads (and worker models) to use
+ */
+void Model::RunBasicWorkers(unsigned threads) {
+  unsigned row_count = adressable_values_count_ - 1;
+  LOG_MEDIUM() << "Running " << row_count << " sets of input values using " << threads << " threads";
+
+  utilities::RunParameters run_parameters = global_configuration_->run_parameters();
+  run_parameters.threads_ = 1;
+  run_parameters.estimable_value_input_file_ = ""; // the workers are given each row by us
+  workers_.clear();
+  workers_.resize(threads);
+
+  struct RowOutput {
+    std::deque<reports::Manager::QueuedOutput> queue_;
+    map<string, string>                          caches_;
+    bool                                         finished_ = false;
+  };
+  unsigned window = 4 * threads;
+  vector<RowOutput> outputs(window);
+  unsigned next_row = 0;
+  unsigned next_output = 0;
+  bool failed = false;
+  std::mutex row_lock;
+  std::condition_variable output_written;
+  Estimables& estimables = *managers_->estimables();
+
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    workers_[thread] = CreateWorker(run_parameters);
+    Model& worker = *workers_[thread];
+    if (!worker.Prepare(RunMode::kBasic))
+      LOG_FATAL() << "Failed to build the model for basic run thread " << thread + 1;
+    // The output from building the model has already been written by us
+    worker.managers().report()->TakeQueue();
+    worker.managers().report()->TakeCaches();
+
+    try {
+      while (true) {
+        unsigned row = 0;
+        map<string, Double> values;
+        {
+          std::unique_lock<std::mutex> lock(row_lock);
+          output_written.wait(lock, [&]() { return failed || next_row >= row_count || next_row < next_output + window; });
+          if (failed || next_row >= row_count)
+            break;
+          row = next_row++;
+          values = estimables.GetValues(row);
+        }
+
+        worker.managers().report()->SetFirstRun(row == 0);
+        worker.managers().estimables()->SetValues(values);
+        worker.Reset();
+        worker.RunBasic();
+
+        std::lock_guard<std::mutex> lock(row_lock);
+        RowOutput& output = outputs[row % window];
+        output.queue_    = worker.managers().report()->TakeQueue();
+        output.caches_   = worker.managers().report()->TakeCaches();
+        output.finished_ = true;
+        for (; next_output < row_count && outputs[next_output % window].finished_; ++next_output) {
+          RowOutput& next = outputs[next_output % window];
+          managers_->report()->Enqueue(next.queue_);
+          managers_->report()->AppendCaches(next.caches_);
+          next.caches_.clear();
+          next.finished_ = false;
+        }
+        output_written.notify_all();
+      }
+    } catch (...) {
+      // don't leave the other workers waiting for the output of our row
+      std::lock_guard<std::mutex> lock(row_lock);
+      failed = true;
+      output_written.notify_all();
+      throw;
+    }
+  });
+
+  // The headers have been written by the worker that ran the first row
+  managers_->report()->SetFirstRun(false);
+}
+
 /**
  * Run the model in estimation mode.
  */
@@ -539,10 +730,14 @@ void Model::RunEstimation() {
   Estimables* estimables = managers_->estimables();
   map<string, Double> estimable_values;
   LOG_FINE() << "estimable values count: " << adressable_values_count_;
+#ifndef USE_AUTODIFF
+  set_record_checkpoints(true);
+#endif
   for (unsigned i = 0; i < adressable_values_count_; ++i) {
     if (addressable_values_file_) {
       estimables->LoadValues(i);
       Reset();
+      ClearCheckpoints();
     }
 
     run_mode_ = RunMode::kEstimation;
@@ -550,10 +745,14 @@ void Model::RunEstimation() {
     unsigned max_iters = managers_->estimate()->GetNumberOfPhases();
 
     LOG_FINE() << "found iterations = " << max_iters;
-    for (unsigned j = 1; j <= max_iters; ++j) {
-    	LOG_MEDIUM() << "model.estimation_phase: " << j;
-      managers_->estimate()->SetActivePhase(j);
-      minimiser->Execute();
+    if (global_configuration_->estimation_starts() > 1) {
+      RunEstimationStarts(global_configuration_->estimation_starts());
+    } else {
+      for (unsigned j = 1; j <= max_iters; ++j) {
+        LOG_MEDIUM() << "model.estimation_phase: " << j;
+        managers_->estimate()->SetActivePhase(j);
+        minimiser->Execute();
+      }
     }
 
     minimiser->BuildCovarianceMatrix();
@@ -565,6 +764,137 @@ void Model::RunEstimation() {
     LOG_FINE() << "Model: State change to Iteration Complete";
     managers_->report()->Execute(State::kIterationComplete);
   }
+
+  set_record_checkpoints(false);
+}
+
+/**
+ * Estimate from multiple starting points (--starts) on worker models, one
+ * per thread. The first start uses the current estimate values. Every
+ * other start draws each estimate uniformly between its bounds from its own
+ * random number stream (the start index), so the starting points do not
+ * depend on the number of threads.
+ *
+ * Each worker runs all of the estimation phases for the starts it takes. The
+ * converged start with the lowest objective function score (or the lowest
+ * score if no start converged) is copied back to this model and the last
+ * phase is run again from it, so our minimiser has the Hessian for the
+ * covariance matrix and the MPD. The result of every start is kept on the
+ * minimiser for the multi_start report.
+ *
+ * @param start_count The number of starts to run
+ */
+void Model::RunEstimationStarts(unsigned start_count) {
+  auto minimiser = managers_->minimiser()->active_minimiser();
+  vector<Estimate*> estimates = managers_->estimate()->objects();
+  unsigned phases = managers_->estimate()->GetNumberOfPhases();
+
+  vector<string> parameters;
+  vector<vector<Double>> start_values(start_count);
+  utilities::RandomNumberGenerator start_generator;
+  for (unsigned start = 0; start < start_count; ++start) {
+    start_generator.Reset(random_number_generator_->seed(), start);
+    for (Estimate* estimate : estimates) {
+      if (start == 0)
+        parameters.push_back(estimate->parameter());
+      if (start == 0 || !estimate->estimated())
+        start_values[start].push_back(estimate->value());
+      else
+        start_values[start].push_back(start_generator.uniform(AS_DOUBLE(estimate->lower_bound()), AS_DOUBLE(estimate->upper_bound())));
+    }
+  }
+
+  unsigned threads = utilities::Parallel::ThreadCount(global_configuration_->threads(), start_count);
+#ifdef USE_AUTODIFF
+  threads = 1; // the auto-differentiation tapes are not thread safe
+#endif
+  LOG_MEDIUM() << "Running " << start_count << " estimation starts using " << threads << " threads";
+
+  utilities::RunParameters run_parameters = global_configuration_->run_parameters();
+  run_parameters.threads_ = 1;
+  run_parameters.estimation_starts_ = 1;
+  if (workers_.size() != threads) {
+    workers_.clear();
+    workers_.resize(threads);
+  }
+
+  vector<minimiser::StartResult> results(start_count);
+  std::atomic<unsigned> next_start(0);
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    if (!workers_[thread]) {
+      workers_[thread] = CreateWorker(run_parameters);
+      if (!workers_[thread]->Prepare(RunMode::kEstimation))
+        LOG_FATAL() << "Failed to build the model for estimation thread " << thread + 1;
+#ifndef USE_AUTODIFF
+      workers_[thread]->set_record_checkpoints(true);
+#endif
+    }
+
+    Model& worker = *workers_[thread];
+    auto worker_minimiser = worker.managers().minimiser()->active_minimiser();
+    vector<Estimate*> worker_estimates = worker.managers().estimate()->objects();
+    for (unsigned start = next_start++; start < start_count; start = next_start++) {
+      CopyEstimateValues(worker);
+      for (unsigned i = 0; i < worker_estimates.size(); ++i)
+        worker_estimates[i]->set_value(start_values[start][i]);
+      worker.ClearCheckpoints();
+      worker.Iterate();
+
+      for (unsigned phase = 1; phase <= phases; ++phase) {
+        LOG_MEDIUM() << "estimation start " << start + 1 << " phase: " << phase;
+        worker.managers().estimate()->SetActivePhase(phase);
+        worker_minimiser->Execute();
+      }
+      worker.FullIteration();
+
+      minimiser::StartResult& result = results[start];
+      result.start_     = start;
+      result.score_     = worker.objective_function().score();
+      result.result_    = worker_minimiser->result();
+      result.converged_ = result.result_ == MinimiserResult::kSuccess || result.result_ == MinimiserResult::kStepSizeTooSmallSuccess;
+      for (Estimate* estimate : worker_estimates)
+        result.values_.push_back(estimate->value());
+      worker.managers().report()->TakeQueue();
+    }
+  });
+
+  /**
+   * Group the converged starts in to optima from the lowest score. Starts
+   * within optimum_tolerance of the first score of an optimum are treated
+   * as finding the same optimum.
+   */
+  const double optimum_tolerance = 0.01;
+  vector<unsigned> order;
+  for (unsigned start = 0; start < start_count; ++start)
+    order.push_back(start);
+  std::stable_sort(order.begin(), order.end(), [&](unsigned lhs, unsigned rhs) {
+    if (results[lhs].converged_ != results[rhs].converged_)
+      return results[lhs].converged_;
+    return AS_DOUBLE(results[lhs].score_) < AS_DOUBLE(results[rhs].score_);
+  });
+
+  unsigned optimum = 0;
+  double optimum_score = 0.0;
+  for (unsigned start : order) {
+    if (!results[start].converged_)
+      break;
+    if (optimum == 0 || AS_DOUBLE(results[start].score_) - optimum_score > optimum_tolerance) {
+      ++optimum;
+      optimum_score = AS_DOUBLE(results[start].score_);
+    }
+    results[start].optimum_ = optimum;
+  }
+
+  minimiser::StartResult& best = results[order[0]];
+  best.best_ = true;
+  LOG_MEDIUM() << "Best estimation start was " << best.start_ + 1 << " with a score of " << best.score_ << ", " << optimum << " optima were found";
+
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    estimates[i]->set_value(best.values_[i]);
+  ClearCheckpoints();
+  managers_->estimate()->SetActivePhase(phases);
+  minimiser->Execute();
+  minimiser->set_start_results(parameters, results);
 }
 
 /**
@@ -591,7 +921,7 @@ bool Model::RunMCMC() {
       return false;
 
     // reset RNG seed for resume
-    utilities::RandomNumberGenerator::Instance().Reset((unsigned int)time(NULL));
+    random_number_generator_->Reset((unsigned int)time(NULL));
 
   } else if (!global_configuration_->skip_estimation()){
     /**
@@ -612,6 +942,12 @@ bool Model::RunMCMC() {
     minimiser->BuildCovarianceMatrix();
     LOG_FINE() << "Minimisation complete. Starting MCMC";
   }
+  if (global_configuration_->mcmc_chains() > 1) {
+    mcmcs::MultiChain multi_chain(this);
+    multi_chain.Execute();
+    return true;
+  }
+
   LOG_FINE() << "Begin MCMC chain";
   mcmc->Execute();
   return true;
@@ -621,13 +957,29 @@ bool Model::RunMCMC() {
  *
  */
 void Model::RunProfiling() {
+  unsigned point_count = 0;
+  for (auto profile : managers_->profile()->objects())
+    point_count += profile->point_count();
+  unsigned threads = utilities::Parallel::ThreadCount(global_configuration_->threads(), point_count);
+#ifdef USE_AUTODIFF
+  threads = 1; // the auto-differentiation tapes are not thread safe
+#endif
+  if (threads > 1) {
+    RunProfilingWorkers(threads);
+    return;
+  }
+
   Estimables& estimables = *managers_->estimables();
 
   map<string, Double> estimable_values;
+#ifndef USE_AUTODIFF
+  set_record_checkpoints(true);
+#endif
   for (unsigned i = 0; i < adressable_values_count_; ++i) {
     if (addressable_values_file_) {
       estimables.LoadValues(i);
       Reset();
+      ClearCheckpoints();
     }
 
     LOG_FINE() << "Doing pre-profile iteration of the model";
@@ -664,6 +1016,129 @@ void Model::RunProfiling() {
       estimate_manager.FlagIsEstimated(profile->parameter());
     }
   }
+
+  set_record_checkpoints(false);
+}
+
+/**
+ * Run the profile points on worker models, one per thread (--threads).
+ *
+ * Every step of every profile is a point and the workers take the next
+ * point until all have been run. A point is minimised from the estimate
+ * values of the nearest step of the same profile that has already
+ * finished, or from the starting values if none has. The report output
+ * of each point is handed to our report writer in profile and step order,
+ * so the reports are in the same order a single thread would write them.
+ *
+ * @param threads The number of threads (and worker models) to use
+ */
+void Model::RunProfilingWorkers(unsigned threads) {
+  vector<Profile*> profiles = managers_->profile()->objects();
+  vector<std::pair<unsigned, unsigned>> points; // profile, step
+  for (unsigned profile = 0; profile < profiles.size(); ++profile) {
+    for (unsigned step = 0; step < profiles[profile]->point_count(); ++step)
+      points.push_back(std::make_pair(profile, step));
+  }
+  LOG_MEDIUM() << "Running " << points.size() << " profile points using " << threads << " threads";
+
+  utilities::RunParameters run_parameters = global_configuration_->run_parameters();
+  run_parameters.threads_ = 1;
+  workers_.resize(threads);
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    workers_[thread] = CreateWorker(run_parameters);
+    if (!workers_[thread]->Prepare(RunMode::kProfiling))
+      LOG_FATAL() << "Failed to build the model for profiling thread " << thread + 1;
+    // The output from building the model has already been written by us
+    workers_[thread]->managers().report()->TakeQueue();
+    workers_[thread]->set_record_checkpoints(true);
+  });
+
+  for (unsigned i = 0; i < adressable_values_count_; ++i) {
+    if (addressable_values_file_) {
+      managers_->estimables()->LoadValues(i);
+      Reset();
+    }
+
+    LOG_FINE() << "Doing pre-profile iteration of the model";
+    Iterate();
+
+    vector<Double> start_values;
+    for (auto estimate : managers_->estimate()->objects())
+      start_values.push_back(estimate->value());
+    for (auto& worker : workers_)
+      CopyEstimateValues(*worker);
+
+    // the estimate values each finished step ended at, for the warm starts
+    vector<vector<vector<Double>>> step_values(profiles.size());
+    for (unsigned profile = 0; profile < profiles.size(); ++profile)
+      step_values[profile].resize(profiles[profile]->point_count());
+
+    vector<std::deque<reports::Manager::QueuedOutput>> outputs(points.size());
+    vector<bool> finished(points.size(), false);
+    unsigned next_output = 0;
+    std::mutex lock;
+    std::atomic<unsigned> next_point(0);
+
+    utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+      Model& worker = *workers_[thread];
+      auto minimiser = worker.managers().minimiser()->active_minimiser();
+      if (!minimiser)
+        LOG_FATAL() << "couldn't get an active minimiser to estimate for the profile";
+      estimates::Manager& estimate_manager = *worker.managers().estimate();
+      vector<Estimate*> estimates = estimate_manager.objects();
+      vector<Profile*> worker_profiles = worker.managers().profile()->objects();
+
+      for (unsigned index = next_point++; index < points.size(); index = next_point++) {
+        unsigned step = points[index].second;
+        Profile* profile = worker_profiles[points[index].first];
+        vector<vector<Double>>& values = step_values[points[index].first];
+
+        vector<Double> warm_start = start_values;
+        {
+          std::lock_guard<std::mutex> guard(lock);
+          for (unsigned distance = 1; distance < values.size(); ++distance) {
+            if (step >= distance && values[step - distance].size() != 0) {
+              warm_start = values[step - distance];
+              break;
+            }
+            if (step + distance < values.size() && values[step + distance].size() != 0) {
+              warm_start = values[step + distance];
+              break;
+            }
+          }
+        }
+
+        LOG_FINE() << "Profiling " << profile->parameter() << " step " << step + 1 << " on thread " << thread + 1;
+        estimate_manager.UnFlagIsEstimated(profile->parameter());
+        for (unsigned j = 0; j < estimates.size(); ++j)
+          estimates[j]->set_value(warm_start[j]);
+        profile->SetStep(step);
+        worker.ClearCheckpoints();
+
+        minimiser->Execute();
+        worker.run_mode_ = RunMode::kBasic;
+        worker.FullIteration();
+        worker.run_mode_ = RunMode::kProfiling;
+        worker.managers().report()->Execute(State::kIterationComplete);
+
+        vector<Double> finished_values;
+        for (auto estimate : estimates)
+          finished_values.push_back(estimate->value());
+        profile->RestoreOriginalValue();
+        estimate_manager.FlagIsEstimated(profile->parameter());
+
+        std::deque<reports::Manager::QueuedOutput> output = worker.managers().report()->TakeQueue();
+        std::lock_guard<std::mutex> guard(lock);
+        values[step] = finished_values;
+        outputs[index] = std::move(output);
+        finished[index] = true;
+        for (; next_output < points.size() && finished[next_output]; ++next_output)
+          managers_->report()->Enqueue(outputs[next_output]);
+      }
+    });
+  }
+
+  managers_->report()->WaitForReportsToFinish();
 }
 
 /**
@@ -681,151 +1156,375 @@ void Model::RunSimulation() {
     estimables->LoadValues(0);
     Reset();
   }
-  niwa::partition::accessors::All all_view(this);
-
 
   int simulation_candidates = global_configuration_->simulation_candidates();
   if (simulation_candidates < 1) {
     LOG_FATAL() << "The number of simulations specified at the command line parser must be at least one";
   }
-  unsigned suffix_width          = (unsigned)floor(log10((double) simulation_candidates + 1)) + 1;
+
+  unsigned threads = utilities::Parallel::ThreadCount(global_configuration_->threads(), simulation_candidates);
+  if (threads > 1) {
+    RunSimulationWorkers(simulation_candidates, threads);
+    return;
+  }
+
   for (int i = 0; i < simulation_candidates; ++i) {
-    string report_suffix = ".";
-    unsigned iteration_width = (unsigned)floor(log10(i + 1)) + 1;
+    RunSimulationCandidate(i, simulation_candidates);
+    managers_->report()->WaitForReportsToFinish();
+  }
+}
 
-    unsigned diff = suffix_width - iteration_width;
-    report_suffix.append(diff,'0');
-    report_suffix.append(utilities::ToInline<unsigned, string>(i + 1));
-    managers_->report()->set_report_suffix(report_suffix);
+/**
+ * Run a single simulation candidate. Each candidate draws from its own
+ * random number stream (the candidate index) so the simulated observations
+ * do not depend on which model or thread the candidate is run on.
+ *
+ * @param candidate The index of the candidate
+ * @param candidate_count The number of candidates being run (for the report suffix width)
+ */
+void Model::RunSimulationCandidate(unsigned candidate, unsigned candidate_count) {
+  niwa::partition::accessors::All all_view(this);
 
-    Reset();
+  unsigned suffix_width    = (unsigned)floor(log10((double) candidate_count + 1)) + 1;
+  string report_suffix     = ".";
+  unsigned iteration_width = (unsigned)floor(log10(candidate + 1)) + 1;
 
-    state_ = State::kInitialise;
-    current_year_ = start_year_;
+  unsigned diff = suffix_width - iteration_width;
+  report_suffix.append(diff,'0');
+  report_suffix.append(utilities::ToInline<unsigned, string>(candidate + 1));
+  managers_->report()->set_report_suffix(report_suffix);
+
+  random_number_generator_->Split(candidate);
+  Reset();
+
+  state_ = State::kInitialise;
+  current_year_ = start_year_;
+  // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+  for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+    (*iterator)->UpdateMeanLengthData();
+  }
+
+  initialisationphases::Manager& init_phase_manager = *managers_->initialisation_phase();
+  init_phase_manager.Execute();
+  managers_->report()->Execute(State::kInitialise);
+
+  state_ = State::kExecute;
+  timesteps::Manager& time_step_manager = *managers_->time_step();
+  timevarying::Manager& time_varying_manager = *managers_->time_varying();
+  for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+    LOG_FINE() << "Iteration year: " << current_year_;
+    time_varying_manager.Update(current_year_);
     // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
     for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
       (*iterator)->UpdateMeanLengthData();
     }
+    managers_->simulate()->Update(current_year_);
+    time_step_manager.Execute(current_year_);
+  }
 
-    initialisationphases::Manager& init_phase_manager = *managers_->initialisation_phase();
-    init_phase_manager.Execute();
-    managers_->report()->Execute(State::kInitialise);
-
-    state_ = State::kExecute;
-    timesteps::Manager& time_step_manager = *managers_->time_step();
-    timevarying::Manager& time_varying_manager = *managers_->time_varying();
-    for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
-      LOG_FINE() << "Iteration year: " << current_year_;
-      time_varying_manager.Update(current_year_);
-      // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-      for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-        (*iterator)->UpdateMeanLengthData();
-      }
-      managers_->simulate()->Update(current_year_);
-      time_step_manager.Execute(current_year_);
-    }
-
-    managers_->observation()->CalculateScores();
-
-    // Model has finished so we can run finalise.
-    LOG_FINE() << "Model: State change to PostExecute";
-    managers_->report()->Execute(State::kIterationComplete);
+  managers_->observation()->CalculateScores();
 
-    managers_->report()->WaitForReportsToFinish();
-  }
+  // Model has finished so we can run finalise.
+  LOG_FINE() << "Model: State change to PostExecute";
+  managers_->report()->Execute(State::kIterationComplete);
 }
 
 /**
+ * Run the simulation candidates on worker models, one per thread (--threads).
  *
+ * Workers take the next candidate until all have been run. The output of
+ * each candidate is collected from the worker and handed to our report
+ * writer in candidate order, so the suffixed reports are written exactly as
+ * they would be by a single thread.
+ *
+ * @param candidate_count The number of candidates to run
+ * @param threads The number of threads (and worker models) to use
  */
+void Model::RunSimulationWorkers(unsigned candidate_count, unsigned threads) {
+  LOG_MEDIUM() << "Running " << candidate_count << " simulation candidates using " << threads << " threads";
+
+  utilities::RunParameters run_parameters = global_configuration_->run_parameters();
+  run_parameters.threads_ = 1;
+  workers_.resize(threads);
+
+  vector<std::deque<reports::Manager::QueuedOutput>> outputs(candidate_count);
+  vector<bool> finished(candidate_count, false);
+  unsigned next_output = 0;
+  std::mutex output_lock;
+  std::atomic<unsigned> next_candidate(0);
+
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    workers_[thread] = CreateWorker(run_parameters);
+    Model& worker = *workers_[thread];
+    if (!worker.Prepare(RunMode::kSimulation))
+      LOG_FATAL() << "Failed to build the model for simulation thread " << thread + 1;
+    if (worker.addressable_values_file_)
+      worker.managers().estimables()->LoadValues(0);
+
+    for (unsigned candidate = next_candidate++; candidate < candidate_count; candidate = next_candidate++) {
+      worker.RunSimulationCandidate(candidate, candidate_count);
+
+      std::lock_guard<std::mutex> lock(output_lock);
+      outputs[candidate] = worker.managers().report()->TakeQueue();
+      finished[candidate] = true;
+      for (; next_output < candidate_count && finished[next_output]; ++next_output)
+        managers_->report()->Enqueue(outputs[next_output]);
+    }
+  });
 
+  managers_->report()->WaitForReportsToFinish();
+}
+
+/**
+ * Run the projections. For each set of parameters (-i) the model is run
+ * once through the historical years and the state is saved at the year
+ * before the first projected year. Each candidate then starts from that
+ * checkpoint and only runs the projection years.
+ */
 void Model::RunProjection() {
   LOG_TRACE();
   int projection_candidates = global_configuration_->projection_candidates();
   if (projection_candidates < 1) {
     LOG_FATAL() << "The number of projections specified at the command line parser must be at least one";
   }
-  Estimables& estimables = *managers_->estimables();
-  vector<Double*> estimable_targets;
-  // Create an instance of all categories
-  niwa::partition::accessors::All all_view(this);
 
-  // Model is about to run
+  unsigned threads = utilities::Parallel::ThreadCount(global_configuration_->threads(), projection_candidates);
+  if (threads > 1) {
+    RunProjectionWorkers(projection_candidates, threads);
+    return;
+  }
+
+  Checkpoint checkpoint;
   for (unsigned i = 0; i < adressable_values_count_; ++i) {
-    for (int j = 0; j < projection_candidates; ++j) {
-      LOG_FINE() << "Beginning initial model run for projections";
-      projection_final_phase_ = false;
-      if (addressable_values_file_) {
-        LOG_FINE() << "loading input parameters";
-        estimables.LoadValues(i);
-        Reset();
-      }
+    RunProjectionHistory(i, checkpoint);
+    for (int j = 0; j < projection_candidates; ++j)
+      RunProjectionCandidate(i * projection_candidates + j, checkpoint);
+  }
+}
 
-      LOG_FINE() << "Model: State change to Execute";
-      state_ = State::kInitialise;
-      current_year_ = start_year_;
-      // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-      for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-        (*iterator)->UpdateMeanLengthData();
-      }
-      initialisationphases::Manager& init_phase_manager = *managers_->initialisation_phase();
-      init_phase_manager.Execute();
+/**
+ * Run the deterministic part of a projection for one set of parameters.
+ *
+ * The first run stores the parameter values the @project blocks sample
+ * from. The second run is the projection run up to the year before the
+ * first year any @project block changes a value (at most final_year).
+ * The model state at the end of that year is saved in the checkpoint.
+ *
+ * @param parameter_set The index of the parameter set in the -i file
+ * @param checkpoint The checkpoint to save the model state to
+ */
+void Model::RunProjectionHistory(unsigned parameter_set, Checkpoint& checkpoint) {
+  niwa::partition::accessors::All all_view(this);
+  Estimables& estimables = *managers_->estimables();
 
-      state_ = State::kExecute;
+  LOG_FINE() << "Beginning initial model run for projections";
+  projection_final_phase_ = false;
+  if (addressable_values_file_) {
+    LOG_FINE() << "loading input parameters";
+    estimables.LoadValues(parameter_set);
+    Reset();
+  }
 
-      timesteps::Manager& time_step_manager = *managers_->time_step();
-      timevarying::Manager& time_varying_manager = *managers_->time_varying();
-      projects::Manager& project_manager = *managers_->project();
+  LOG_FINE() << "Model: State change to Execute";
+  state_ = State::kInitialise;
+  current_year_ = start_year_;
+  // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+  for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+    (*iterator)->UpdateMeanLengthData();
+  }
+  initialisationphases::Manager& init_phase_manager = *managers_->initialisation_phase();
+  init_phase_manager.Execute();
 
-      for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
-        LOG_FINE() << "Iteration year: " << current_year_;
-        time_varying_manager.Update(current_year_);
-        // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-        for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-          (*iterator)->UpdateMeanLengthData();
-        }
-        time_step_manager.Execute(current_year_);
-        project_manager.StoreValues(current_year_);
-      }
+  state_ = State::kExecute;
 
-      /**
-       * Running the model now
-       */
-      LOG_FINE() << "Entering the Projection Sub-System";
-      // Reset the model
-      projection_final_phase_ = true;
-      Reset();
-      state_ = State::kInitialise;
-      current_year_ = start_year_;
-      // Run the intialisation phase
-      init_phase_manager.Execute();
-      // Reset all parameter and re run the model
-      managers_->report()->Execute(State::kInitialise);
-
-      state_ = State::kExecute;
-      LOG_FINE() << "Starting projection years";
-      for (; current_year_ <= projection_final_year_; ++current_year_) {
-        LOG_FINE() << "Iteration year: " << current_year_;
-        // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
-        for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
-          (*iterator)->UpdateMeanLengthData();
-        }
-        project_manager.Update(current_year_);
-        time_step_manager.Execute(current_year_);
-      }
+  timesteps::Manager& time_step_manager = *managers_->time_step();
+  timevarying::Manager& time_varying_manager = *managers_->time_varying();
+  projects::Manager& project_manager = *managers_->project();
+
+  for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+    LOG_FINE() << "Iteration year: " << current_year_;
+    time_varying_manager.Update(current_year_);
+    // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+    for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+      (*iterator)->UpdateMeanLengthData();
+    }
+    time_step_manager.Execute(current_year_);
+    project_manager.StoreValues(current_year_);
+  }
+
+  /**
+   * Running the model now
+   */
+  LOG_FINE() << "Entering the Projection Sub-System";
+  // Reset the model. The projects draw their random values for each candidate
+  // in RunProjectionCandidate() so they are not reset in the final phase here.
+  Reset();
+  projection_final_phase_ = true;
+  state_ = State::kInitialise;
+  current_year_ = start_year_;
+  // Run the intialisation phase
+  init_phase_manager.Execute();
+  managers_->report()->Execute(State::kInitialise);
+
+  unsigned checkpoint_year = final_year_;
+  for (auto project : project_manager.objects()) {
+    for (unsigned year : project->years()) {
+      if (year <= checkpoint_year)
+        checkpoint_year = year - 1;
+    }
+  }
+
+  state_ = State::kExecute;
+  for (; current_year_ <= checkpoint_year; ++current_year_) {
+    LOG_FINE() << "Iteration year: " << current_year_;
+    // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+    for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+      (*iterator)->UpdateMeanLengthData();
+    }
+    project_manager.Update(current_year_);
+    time_step_manager.Execute(current_year_);
+  }
+
+  current_year_ = checkpoint_year;
+  SaveCheckpoint(checkpoint);
+  LOG_FINE() << "Saved the projection checkpoint at the end of year " << checkpoint_year;
+}
+
+/**
+ * Run a single projection candidate from the checkpoint saved by
+ * RunProjectionHistory(). Each candidate draws its projected values from
+ * its own random number stream (the candidate index) so the results do
+ * not depend on which model or thread the candidate is run on.
+ *
+ * @param candidate The index of the candidate over all parameter sets
+ * @param checkpoint The checkpoint to start the projection years from
+ */
+void Model::RunProjectionCandidate(unsigned candidate, const Checkpoint& checkpoint) {
+  niwa::partition::accessors::All all_view(this);
+  timesteps::Manager& time_step_manager = *managers_->time_step();
+  projects::Manager& project_manager = *managers_->project();
 
-      // Model has finished so we can run finalise.
-      LOG_FINE() << "Model: State change to PostExecute and iteration complete";
-      managers_->report()->Execute(State::kIterationComplete);
+  RestoreCheckpoint(checkpoint);
+  random_number_generator_->Split(candidate);
+  project_manager.Reset();
 
-      // Not sure if we need these
-      //managers_->observation()->CalculateScores();
-      //managers_->report()->WaitForReportsToFinish();
-      //Reset();
+  LOG_FINE() << "Starting projection years";
+  for (current_year_ = checkpoint.year() + 1; current_year_ <= projection_final_year_; ++current_year_) {
+    LOG_FINE() << "Iteration year: " << current_year_;
+    // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
+    for (auto iterator = all_view.Begin(); iterator != all_view.End(); ++iterator) {
+      (*iterator)->UpdateMeanLengthData();
     }
+    project_manager.Update(current_year_);
+    time_step_manager.Execute(current_year_);
+  }
+
+  // Model has finished so we can run finalise.
+  LOG_FINE() << "Model: State change to PostExecute and iteration complete";
+  managers_->report()->Execute(State::kIterationComplete);
+}
+
+/**
+ * Run the projection candidates on worker models, one per thread (--threads).
+ *
+ * For each set of parameters every worker runs the historical years once
+ * and keeps its own checkpoint, then takes the next candidate until all
+ * have been run. The report output of the historical years is kept from
+ * one worker and the output of each candidate is handed to our report
+ * writer in candidate order, so the reports are the same as a single
+ * thread would write.
+ *
+ * @param candidate_count The number of candidates per parameter set
+ * @param threads The number of threads (and worker models) to use
+ */
+void Model::RunProjectionWorkers(unsigned candidate_count, unsigned threads) {
+  LOG_MEDIUM() << "Running " << candidate_count << " projection candidates using " << threads << " threads";
+
+  utilities::RunParameters run_parameters = global_configuration_->run_parameters();
+  run_parameters.threads_ = 1;
+  workers_.resize(threads);
+  vector<Checkpoint> checkpoints(threads);
+
+  utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+    workers_[thread] = CreateWorker(run_parameters);
+    if (!workers_[thread]->Prepare(RunMode::kProjection))
+      LOG_FATAL() << "Failed to build the model for projection thread " << thread + 1;
+  });
+
+  for (unsigned i = 0; i < adressable_values_count_; ++i) {
+    // output 0 is the historical years, output n is candidate n
+    vector<std::deque<reports::Manager::QueuedOutput>> outputs(candidate_count + 1);
+    vector<bool> finished(candidate_count + 1, false);
+    unsigned next_output = 0;
+    std::mutex output_lock;
+    std::atomic<unsigned> next_candidate(0);
+
+    auto forward = [&](unsigned index, std::deque<reports::Manager::QueuedOutput> output) {
+      std::lock_guard<std::mutex> lock(output_lock);
+      if (finished[index])
+        return;
+      outputs[index] = std::move(output);
+      finished[index] = true;
+      for (; next_output <= candidate_count && finished[next_output]; ++next_output)
+        managers_->report()->Enqueue(outputs[next_output]);
+    };
+
+    utilities::Parallel::For(threads, threads, [&](unsigned thread) {
+      Model& worker = *workers_[thread];
+      worker.RunProjectionHistory(i, checkpoints[thread]);
+      forward(0, worker.managers().report()->TakeQueue());
+
+      for (unsigned candidate = next_candidate++; candidate < candidate_count; candidate = next_candidate++) {
+        worker.RunProjectionCandidate(i * candidate_count + candidate, checkpoints[thread]);
+        forward(candidate + 1, worker.managers().report()->TakeQueue());
+      }
+    });
   }
-  // Print the report to disk if tabular
-  //managers_->report()->Finalise();
+
+  managers_->report()->WaitForReportsToFinish();
+}
+
+/**
+ * Save the state of the model at the end of the current year so it can be
+ * restored with RestoreCheckpoint() instead of re-running the years before it.
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void Model::SaveCheckpoint(Checkpoint& checkpoint) {
+  checkpoint.Clear();
+  checkpoint.set_year(current_year_);
+  partition_->SaveState(checkpoint);
+  for (auto process : managers_->process()->objects())
+    process->SaveState(checkpoint);
+  for (auto project : managers_->project()->objects())
+    project->SaveState(checkpoint);
+  for (auto derived_quantity : managers_->derived_quantity()->objects())
+    derived_quantity->SaveState(checkpoint);
+  for (auto observation : managers_->observation()->objects())
+    observation->SaveState(checkpoint);
+  managers_->penalty()->SaveState(checkpoint);
+}
+
+/**
+ * Restore the state of the model saved by SaveCheckpoint(). The
+ * next year to run is the year after checkpoint.year().
+ *
+ * @param checkpoint The checkpoint to restore
+ */
+void Model::RestoreCheckpoint(const Checkpoint& checkpoint) {
+  partition_->RestoreState(checkpoint);
+  for (auto process : managers_->process()->objects())
+    process->RestoreState(checkpoint);
+  for (auto project : managers_->project()->objects())
+    project->RestoreState(checkpoint);
+  for (auto derived_quantity : managers_->derived_quantity()->objects())
+    derived_quantity->RestoreState(checkpoint);
+  for (auto observation : managers_->observation()->objects())
+    observation->RestoreState(checkpoint);
+  managers_->penalty()->RestoreState(checkpoint);
+
+  state_ = State::kExecute;
+  current_year_ = checkpoint.year();
 }
 
 /**
@@ -848,10 +1547,33 @@ void Model::Iterate() {
   init_phase_manager.Execute();
   managers_->report()->Execute(State::kInitialise);
 
+  if (record_checkpoints_) {
+    checkpoint_estimate_values_.clear();
+    for (auto estimate : managers_->estimate()->objects())
+      checkpoint_estimate_values_.push_back(estimate->value());
+
+    current_year_ = start_year_ - 1;
+    SaveCheckpoint(checkpoints_[current_year_]);
+  }
+
+  IterateYears(start_year_, record_checkpoints_ && record_year_checkpoints_);
+}
+
+/**
+ * Run the model years from first_year to the final year then calculate
+ * the observation scores. The model must already be initialised or
+ * restored from the checkpoint for the end of the year before first_year.
+ *
+ * @param first_year The first year to run
+ * @param record True if a checkpoint should be saved at the end of each year
+ */
+void Model::IterateYears(unsigned first_year, bool record) {
+  niwa::partition::accessors::All all_view(this);
+
   state_ = State::kExecute;
   timesteps::Manager& time_step_manager = *managers_->time_step();
   timevarying::Manager& time_varying_manager = *managers_->time_varying();
-  for (current_year_ = start_year_; current_year_ <= final_year_; ++current_year_) {
+  for (current_year_ = first_year; current_year_ <= final_year_; ++current_year_) {
     LOG_FINE() << "Iteration year: " << current_year_;
     time_varying_manager.Update(current_year_);
     // Iterate over all partition members and UpDate Mean Weight for the inital weight calculations
@@ -859,12 +1581,16 @@ void Model::Iterate() {
       (*iterator)->UpdateMeanLengthData();
     }
     time_step_manager.Execute(current_year_);
+    if (record)
+      SaveCheckpoint(checkpoints_[current_year_]);
   }
 
   managers_->observation()->CalculateScores();
 
-  for (auto executor : executors_[State::kExecute])
+  for (auto executor : executors_[State::kExecute]) {
+    Timings::Timer timer(timings_, executor, nullptr, Timings::Method::kExecute);
     executor->Execute();
+  }
 
   current_year_ = final_year_;
 }
@@ -873,7 +1599,175 @@ void Model::Iterate() {
  *
  */
 void Model::FullIteration() {
+  if (record_checkpoints_) {
+    unsigned first_year = FirstChangedYear();
+    if (first_year >= start_year_ && Resume(first_year))
+      return;
+  }
+
   Reset();
   Iterate();
 }
+
+/**
+ * Run the model from the start of a year using the latest checkpoint recorded
+ * before it. The result is the same as a full iteration as long as nothing that
+ * affects the years before this year has changed since the checkpoints were
+ * recorded (see FirstChangedYear()).
+ *
+ * When the model is resumed from the start year only the cached initialisation
+ * is reused. Every year is run again so the year checkpoints are recorded again
+ * with the current estimate values.
+ *
+ * @param year The first year to run
+ * @return true if the model was resumed, false if there was no checkpoint to resume from
+ */
+bool Model::Resume(unsigned year) {
+  if (year < start_year_ || year > final_year_ + 1)
+    return false;
+  auto iter = checkpoints_.upper_bound(year - 1);
+  if (iter == checkpoints_.begin())
+    return false;
+  --iter;
+
+  LOG_FINE() << "Resuming the model from the checkpoint at the end of year " << iter->first;
+  Reset();
+  RestoreCheckpoint(iter->second);
+  if (iter->first + 1 == start_year_) {
+    checkpoint_estimate_values_.clear();
+    for (auto estimate : managers_->estimate()->objects())
+      checkpoint_estimate_values_.push_back(estimate->value());
+    IterateYears(start_year_, record_year_checkpoints_);
+  } else
+    IterateYears(iter->first + 1, false);
+  return true;
+}
+
+/**
+ * Compare the current estimate values against those the checkpoints were
+ * recorded with to find the first year the changes could affect.
+ *
+ * @return The first year to run again, final_year + 1 if nothing has changed or 0 if the whole model must be run
+ */
+unsigned Model::FirstChangedYear() {
+  if (checkpoints_.size() == 0 || managers_->estimate_transformation()->objects().size() != 0)
+    return 0;
+  if (managers_->report()->HasTimeStepReports(run_mode_) || managers_->report()->HasStateReports(State::kInitialise, run_mode_))
+    return 0;
+  for (auto time_varying : managers_->time_varying()->objects()) {
+    if (time_varying->type() == PARAM_RANDOMWALK || time_varying->type() == PARAM_RANDOMDRAW)
+      return 0; // these draw new random numbers every year
+  }
+
+  vector<Estimate*> estimates = managers_->estimate()->objects();
+  if (estimates.size() != checkpoint_estimate_values_.size() || estimates.size() != estimate_first_years_.size())
+    return 0;
+
+  unsigned first_year = final_year_ + 1;
+  for (unsigned i = 0; i < estimates.size(); ++i) {
+    if (AS_DOUBLE(estimates[i]->value()) == AS_DOUBLE(checkpoint_estimate_values_[i]))
+      continue;
+
+    unsigned year = estimate_first_years_[i];
+    if (year < start_year_)
+      return 0;
+    first_year = year < first_year ? year : first_year;
+  }
+
+  return first_year;
+}
+
+/**
+ * Find the first year affected by changing the value of an estimate. An
+ * estimate that is not an input to the initialisation phases affects the
+ * start year so the cached initialisation can still be used.
+ *
+ * @param estimate The estimate to check
+ * @return The first year affected, 0 if the whole model must be run
+ */
+unsigned Model::EstimateFirstYear(Estimate* estimate) {
+  if (estimate->sames().size() != 0)
+    return 0;
+
+  string type = "";
+  string label = "";
+  string addressable = "";
+  string index = "";
+  objects_->ExplodeString(estimate->parameter(), type, label, addressable, index);
+  base::Object* target = objects_->FindObjectOrNull(estimate->parameter());
+  if (target == nullptr)
+    return 0;
+
+  unsigned year = index == "" ? 0 : target->GetAddressableFirstYear(addressable, index);
+  if (year >= start_year_)
+    return year;
+  return IsInitialisationInput(type, label) ? 0 : start_year_;
+}
+
+/**
+ * Check if an object could change the result of the initialisation phases.
+ * Catchabilities and observations are only used when calculating the
+ * observations. A selectivity is only an input if a process, derived
+ * quantity or initialisation phase references it.
+ *
+ * @param type The type of the object (e.g. selectivity)
+ * @param label The label of the object
+ * @return true if the object could change the initialisation, false otherwise
+ */
+bool Model::IsInitialisationInput(const string& type, const string& label) {
+  if (type == PARAM_CATCHABILITY || type == PARAM_OBSERVATION)
+    return false;
+  if (type != PARAM_SELECTIVITY)
+    return true;
+
+  for (auto process : managers_->process()->objects()) {
+    if (process->parameters().HasValue(label))
+      return true;
+  }
+  for (auto derived_quantity : managers_->derived_quantity()->objects()) {
+    if (derived_quantity->parameters().HasValue(label))
+      return true;
+  }
+  for (auto initialisation_phase : managers_->initialisation_phase()->objects()) {
+    if (initialisation_phase->parameters().HasValue(label))
+      return true;
+  }
+
+  return false;
+}
+
+/**
+ * Turn the recording of checkpoints on or off. Checkpoints are only recorded
+ * if at least one of the estimates can be changed without running the
+ * whole model again, otherwise recording them is wasted effort. The state
+ * after initialisation is always recorded, the state at the end of each year
+ * is only recorded if an estimate only affects the later years.
+ *
+ * @param record True to record checkpoints
+ */
+void Model::set_record_checkpoints(bool record) {
+  ClearCheckpoints();
+  record_checkpoints_ = false;
+  record_year_checkpoints_ = false;
+  estimate_first_years_.clear();
+  if (!record)
+    return;
+
+  for (auto estimate : managers_->estimate()->objects()) {
+    unsigned year = EstimateFirstYear(estimate);
+    estimate_first_years_.push_back(year);
+    record_checkpoints_ = record_checkpoints_ || year >= start_year_;
+    record_year_checkpoints_ = record_year_checkpoints_ || year > start_year_;
+  }
+  LOG_FINE() << "Recording checkpoints: " << record_checkpoints_ << "; recording year checkpoints: " << record_year_checkpoints_;
+}
+
+/**
+ * Remove the checkpoints recorded so far. This is required whenever the
+ * model is changed by something other than an estimate (e.g. -i values).
+ */
+void Model::ClearCheckpoints() {
+  checkpoints_.clear();
+  checkpoint_estimate_values_.clear();
+}
 } /* namespace niwa */
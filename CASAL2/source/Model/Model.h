@@ -17,9 +17,13 @@
 #define MODEL_H_
 
 // Headers
+#include <memory>
+
 #include "BaseClasses/Executor.h"
 #include "BaseClasses/Object.h"
 #include "GlobalConfiguration/GlobalConfiguration.h"
+#include "Model/Checkpoint.h"
+#include "Model/Timings.h"
 #include "Utilities/Math.h"
 #include "Utilities/PartitionType.h"
 #include "Utilities/RunMode.h"
@@ -27,6 +31,7 @@
 // Namespaces
 namespace niwa {
 using base::Executor;
+class Estimate;
 class Managers;
 class Objects;
 class Categories;
@@ -34,6 +39,9 @@ class Factory;
 class Partition;
 class ObjectiveFunction;
 class EquationParser;
+namespace utilities {
+class RandomNumberGenerator;
+}
 
 namespace State {
 enum Type {
@@ -67,7 +75,15 @@ public:
   Model();
   virtual                     ~Model();
   bool                        Start(RunMode::Type run_mode);
+  bool                        Prepare(RunMode::Type run_mode);
+  std::unique_ptr<Model>      CreateWorker(utilities::RunParameters run_parameters);
+  void                        CopyEstimateValues(Model& worker);
   void                        FullIteration();
+  void                        SaveCheckpoint(Checkpoint& checkpoint);
+  void                        RestoreCheckpoint(const Checkpoint& checkpoint);
+  bool                        Resume(unsigned year);
+  unsigned                    FirstChangedYear();
+  void                        ClearCheckpoints();
   void                        Subscribe(State::Type state, Executor* executor) { executors_[state].push_back(executor); }
   void                        PopulateParameters();
 
@@ -85,6 +101,9 @@ public:
   void                        set_b0_initialised(string derived_quantity_label, bool new_b0_initialised) {b0_initialised_[derived_quantity_label] = new_b0_initialised;}
   bool                        projection_final_phase() {return projection_final_phase_;}
   void                        set_projection_final_phase(bool phase) {projection_final_phase_ = phase;}
+  bool                        record_checkpoints() const { return record_checkpoints_; }
+  void                        set_record_checkpoints(bool record);
+  const map<unsigned, Checkpoint>& checkpoints() const { return checkpoints_; }
   virtual vector<unsigned>    years() const;
   virtual vector<unsigned>    years_all() const;
   unsigned                    year_spread() const;
@@ -111,6 +130,8 @@ public:
   virtual Partition&          partition();
   virtual ObjectiveFunction&  objective_function();
   EquationParser&             equation_parser();
+  virtual utilities::RandomNumberGenerator& random_number_generator();
+  Timings&                    timings() { return timings_; }
 
 protected:
   // Methods
@@ -118,13 +139,24 @@ protected:
   void                        Build();
   void                        Verify();
   void                        Iterate();
+  void                        IterateYears(unsigned first_year, bool record);
+  unsigned                    EstimateFirstYear(Estimate* estimate);
+  bool                        IsInitialisationInput(const string& type, const string& label);
   void                        Reset();
   void                        RunBasic();
+  void                        RunBasicWorkers(unsigned threads);
   void                        RunEstimation();
+  void                        RunEstimationStarts(unsigned start_count);
+  void                        RunProfilingWorkers(unsigned threads);
   bool                        RunMCMC();
   void                        RunProfiling();
   void                        RunSimulation();
+  void                        RunSimulationCandidate(unsigned candidate, unsigned candidate_count);
+  void                        RunSimulationWorkers(unsigned candidate_count, unsigned threads);
   void                        RunProjection();
+  void                        RunProjectionHistory(unsigned parameter_set, Checkpoint& checkpoint);
+  void                        RunProjectionCandidate(unsigned candidate, const Checkpoint& checkpoint);
+  void                        RunProjectionWorkers(unsigned candidate_count, unsigned threads);
 
   // Members
   RunMode::Type               run_mode_ = RunMode::kInvalid;
@@ -156,9 +188,17 @@ protected:
   Partition*                  partition_ = nullptr;
   ObjectiveFunction*          objective_function_ = nullptr;
   EquationParser*             equation_parser_ = nullptr;
+  utilities::RandomNumberGenerator* random_number_generator_ = nullptr;
   bool                        projection_final_phase_ = false; // this parameter is for the projection classes. most of the methods are in the reset but they don't need to be applied
   // if the model is in the first iteration and storeing values.
   map<State::Type, vector<Executor*>> executors_;
+  bool                        record_checkpoints_ = false;
+  bool                        record_year_checkpoints_ = false;
+  map<unsigned, Checkpoint>   checkpoints_; // state at the end of each year, start_year_ - 1 is the state after initialisation
+  vector<Double>              checkpoint_estimate_values_; // estimate values when checkpoints_ were recorded
+  vector<unsigned>            estimate_first_years_; // first year affected by each estimate, 0 if it changes the initialisation
+  vector<std::unique_ptr<Model>> workers_; // kept alive while their queued report output is written
+  Timings                     timings_;
 };
 
 } /* namespace niwa */
@@ -0,0 +1,105 @@
+/**
+ * @file Timings.Test.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "Timings.h"
+
+#include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+
+// namespaces
+namespace niwa {
+
+using niwa::testfixtures::InternalEmptyModel;
+using niwa::testcases::test_cases_two_sex_model_population;
+
+const std::string test_cases_timing_report =
+R"(
+@report timing
+type timing
+)";
+
+/**
+ * Find the entry for a timed method, or nullptr if it was never timed
+ */
+const Timings::Entry* FindTiming(Model* model, const string& type, const string& label, const string& method) {
+  for (auto& entry : model->timings().entries()) {
+    if (entry.type_ == type && entry.label_ == label && entry.method_ == method)
+      return &entry;
+  }
+  return nullptr;
+}
+
+/**
+ * Nothing is timed unless a timing report turns the timings on
+ */
+TEST_F(InternalEmptyModel, Timings_Disabled) {
+  AddConfigurationLine(test_cases_two_sex_model_population, "TwoSexModel.h", 27);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  EXPECT_FALSE(model_->timings().enabled());
+  EXPECT_EQ(0u, model_->timings().entries().size());
+}
+
+/**
+ * Check the timing report counts the calls of each process, observation,
+ * derived quantity, initialisation phase and report without changing the model
+ */
+TEST_F(InternalEmptyModel, Timings_Report) {
+  AddConfigurationLine(test_cases_two_sex_model_population, "TwoSexModel.h", 27);
+  AddConfigurationLine(test_cases_timing_report, __FILE__, 28);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  ObjectiveFunction& obj_function = model_->objective_function();
+  EXPECT_DOUBLE_EQ(2698.1334330594036, obj_function.score());
+  EXPECT_TRUE(model_->timings().enabled());
+
+  const Timings::Entry* recruitment = FindTiming(model_, PARAM_PROCESS, "Recruitment", PARAM_EXECUTE);
+  const Timings::Entry* half_m      = FindTiming(model_, PARAM_PROCESS, "halfM", PARAM_EXECUTE);
+  ASSERT_NE(nullptr, recruitment);
+  ASSERT_NE(nullptr, half_m);
+  EXPECT_LE(15u, recruitment->calls_);
+  EXPECT_EQ(recruitment->calls_ * 2, half_m->calls_);
+  EXPECT_LE(0.0, recruitment->seconds_);
+
+  const Timings::Entry* score = FindTiming(model_, PARAM_OBSERVATION, "CAA_year", PARAM_CALCULATE_SCORE);
+  ASSERT_NE(nullptr, score);
+  EXPECT_EQ(1u, score->calls_);
+
+  const Timings::Entry* pre_execute = FindTiming(model_, PARAM_OBSERVATION, "CAA_year", PARAM_PRE_EXECUTE);
+  const Timings::Entry* execute     = FindTiming(model_, PARAM_OBSERVATION, "CAA_year", PARAM_EXECUTE);
+  ASSERT_NE(nullptr, pre_execute);
+  ASSERT_NE(nullptr, execute);
+  EXPECT_LT(0u, pre_execute->calls_);
+  EXPECT_EQ(pre_execute->calls_, execute->calls_);
+
+  const Timings::Entry* abundance = FindTiming(model_, PARAM_DERIVED_QUANTITY, "abundance", PARAM_EXECUTE);
+  ASSERT_NE(nullptr, abundance);
+  EXPECT_LT(0u, abundance->calls_);
+
+  const Timings::Entry* phase = FindTiming(model_, PARAM_INITIALISATION_PHASE, "iphase1", PARAM_EXECUTE);
+  ASSERT_NE(nullptr, phase);
+  EXPECT_EQ(1u, phase->calls_);
+
+  const Timings::Entry* report = FindTiming(model_, PARAM_REPORT, "DQ", PARAM_EXECUTE);
+  ASSERT_NE(nullptr, report);
+  EXPECT_LT(0u, report->calls_);
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,65 @@
+/**
+ * @file Timings.cpp
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "Timings.h"
+
+#include "BaseClasses/Object.h"
+#include "Translations/Translations.h"
+
+// namespaces
+namespace niwa {
+
+/**
+ * Set the calls and time of every entry back to zero
+ */
+void Timings::Reset() {
+  for (Entry& entry : entries_) {
+    entry.calls_   = 0;
+    entry.seconds_ = 0.0;
+  }
+}
+
+/**
+ * Find the entry for a method of an object. The entry is
+ * created the first time the object and method are timed.
+ *
+ * @param object The object being timed
+ * @param type The type of object e.g. process, or nullptr to use its block type
+ * @param method The method being timed
+ * @return The index of the entry in entries_
+ */
+unsigned Timings::Find(const base::Object* object, const char* type, Method method) {
+  auto key = std::make_pair(object, (unsigned)method);
+  auto iter = indexes_.find(key);
+  if (iter != indexes_.end())
+    return iter->second;
+
+  Entry entry;
+  entry.type_  = type != nullptr ? type : object->block_type();
+  entry.label_ = object->label();
+  switch (method) {
+  case Method::kExecute:
+    entry.method_ = PARAM_EXECUTE;
+    break;
+  case Method::kPreExecute:
+    entry.method_ = PARAM_PRE_EXECUTE;
+    break;
+  case Method::kCalculateScore:
+    entry.method_ = PARAM_CALCULATE_SCORE;
+    break;
+  }
+  entries_.push_back(entry);
+  indexes_[key] = entries_.size() - 1;
+  return entries_.size() - 1;
+}
+
+} /* namespace niwa */
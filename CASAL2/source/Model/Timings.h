@@ -0,0 +1,106 @@
+/**
+ * @file Timings.h
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * Timings add up the wall time and the number of calls for each object
+ * on the hot path of a model run (processes, observations, derived
+ * quantities, initialisation phases and reports).
+ *
+ * A Timer is created around each call. When the timings are not enabled
+ * the timer only checks a flag so it can be left in every build. The time
+ * for a call includes any calls nested inside it, e.g. an initialisation
+ * phase includes the processes it runs.
+ */
+#ifndef SOURCE_MODEL_TIMINGS_H_
+#define SOURCE_MODEL_TIMINGS_H_
+
+// headers
+#include <chrono>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+// namespaces
+namespace niwa {
+namespace base {
+class Object;
+}
+
+using std::map;
+using std::pair;
+using std::string;
+using std::vector;
+
+/**
+ * Class definition
+ */
+class Timings {
+public:
+  enum class Method { kExecute, kPreExecute, kCalculateScore };
+
+  struct Entry {
+    string                    type_;
+    string                    label_;
+    string                    method_;
+    unsigned                  calls_ = 0;
+    double                    seconds_ = 0.0;
+  };
+
+  /**
+   * Adds the time between its construction and destruction to the
+   * entry for the object and method
+   */
+  class Timer {
+  public:
+    Timer(Timings& timings, const base::Object* object, const char* type, Method method)
+      : timings_(timings.enabled_ ? &timings : nullptr) {
+      if (timings_ == nullptr)
+        return;
+      index_ = timings_->Find(object, type, method);
+      start_ = std::chrono::steady_clock::now();
+    }
+    ~Timer() {
+      if (timings_ != nullptr)
+        timings_->Add(index_, std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+    }
+    Timer(const Timer&) = delete;
+    Timer& operator=(const Timer&) = delete;
+
+  private:
+    Timings*                  timings_;
+    unsigned                  index_ = 0;
+    std::chrono::steady_clock::time_point start_;
+  };
+
+  // methods
+  Timings() = default;
+  virtual                     ~Timings() = default;
+  void                        Reset();
+
+  // accessors
+  bool                        enabled() const { return enabled_; }
+  void                        set_enabled(bool enabled) { enabled_ = enabled; }
+  const vector<Entry>&        entries() const { return entries_; }
+
+private:
+  // methods
+  unsigned                    Find(const base::Object* object, const char* type, Method method);
+  void                        Add(unsigned index, double seconds) { ++entries_[index].calls_; entries_[index].seconds_ += seconds; }
+
+  // members
+  bool                        enabled_ = false;
+  vector<Entry>               entries_;
+  map<pair<const base::Object*, unsigned>, unsigned> indexes_; // object/method to entries_
+};
+
+} /* namespace niwa */
+
+#endif /* SOURCE_MODEL_TIMINGS_H_ */
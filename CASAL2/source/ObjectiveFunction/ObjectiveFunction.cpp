@@ -45,6 +45,80 @@ void ObjectiveFunction::Clear() {
   score_list_.clear();
 }
 
+/**
+ * Look for the current estimate values in the cache. The values are
+ * compared bit for bit so a hit gives exactly the score a model run would.
+ * On a hit the cached score and its components are loaded and the model
+ * does not need to be run. On a miss the values are remembered so the
+ * score can be added with CacheScore() once it has been calculated.
+ *
+ * This is called before the estimates are restored from their
+ * transformations. The values can change slightly when they are transformed
+ * again so CacheScore() uses the values remembered here.
+ *
+ * @return true if the score was loaded from the cache, false otherwise
+ */
+bool ObjectiveFunction::LoadCachedScore() {
+  cache_key_ = "";
+  if (cache_size_ == 0)
+    return false;
+
+  vector<Estimate*> estimates = model_->managers().estimate()->objects();
+  vector<double> values(estimates.size());
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    values[i] = AS_DOUBLE(estimates[i]->value());
+  cache_key_.assign(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(double));
+
+  auto iter = cache_index_.find(cache_key_);
+  if (iter == cache_index_.end()) {
+    ++cache_misses_;
+    return false;
+  }
+
+  ++cache_hits_;
+  cache_.splice(cache_.begin(), cache_, iter->second);
+  const objective::CachedScore& cached = cache_.front();
+  score_              = cached.score_;
+  penalties_          = cached.penalties_;
+  priors_             = cached.priors_;
+  likelihoods_        = cached.likelihoods_;
+  additional_priors_  = cached.additional_priors_;
+  jacobians_          = cached.jacobians_;
+  score_list_         = cached.score_list_;
+  cache_key_ = "";
+  return true;
+}
+
+/**
+ * Add the score that has just been calculated to the cache for the estimate
+ * values given to the last LoadCachedScore() that missed. When the cache is
+ * full the least recently used score is removed.
+ */
+void ObjectiveFunction::CacheScore() {
+  if (cache_key_ == "" || cache_index_.find(cache_key_) != cache_index_.end())
+    return;
+
+  if (cache_.size() >= cache_size_) {
+    cache_index_.erase(cache_.back().key_);
+    cache_.pop_back();
+  }
+
+  cache_.push_front(objective::CachedScore { cache_key_, score_, penalties_, priors_, likelihoods_, additional_priors_, jacobians_, score_list_ });
+  cache_index_[cache_key_] = cache_.begin();
+  cache_key_ = "";
+}
+
+/**
+ * Remove all of the scores from the cache. This must be called when
+ * anything other than the estimates changes the model (e.g. loading
+ * the next set of values from an input file).
+ */
+void ObjectiveFunction::ClearCache() {
+  cache_.clear();
+  cache_index_.clear();
+  cache_key_ = "";
+}
+
 /**
  * Calculate our score for the current run
  */
@@ -22,7 +22,9 @@
 #define OBJECTIVEFUNCTION_H_
 
 // Headers
+#include <list>
 #include <string>
+#include <unordered_map>
 #include <vector>
 #include <iostream>
 
@@ -44,6 +46,21 @@ struct Score {
   string label_;
   Double score_;
 };
+
+/**
+ * The components of the objective function for one set of estimate
+ * values, kept in the objective function's cache
+ */
+struct CachedScore {
+  string          key_;
+  Double          score_;
+  Double          penalties_;
+  Double          priors_;
+  Double          likelihoods_;
+  Double          additional_priors_;
+  Double          jacobians_;
+  vector<Score>   score_list_;
+};
 }
 
 /**
@@ -56,6 +73,9 @@ public:
   virtual                     ~ObjectiveFunction() = default;
   void                        CalculateScore();
   void                        Clear();
+  bool                        LoadCachedScore();
+  void                        CacheScore();
+  void                        ClearCache();
 
   // Accessors
   const vector<objective::Score>& score_list() const { return score_list_; }
@@ -65,6 +85,10 @@ public:
   Double                          likelihoods() const { return likelihoods_; }
   Double                          additional_priors() const { return additional_priors_; }
   Double                          jacobians() const { return jacobians_; }
+  unsigned                        cache_size() const { return cache_size_; }
+  void                            set_cache_size(unsigned size) { cache_size_ = size; ClearCache(); }
+  unsigned                        cache_hits() const { return cache_hits_; }
+  unsigned                        cache_misses() const { return cache_misses_; }
 
 private:
   // methods
@@ -79,6 +103,12 @@ private:
   Double                      additional_priors_ = 0.0;
   Double                      jacobians_ = 0.0;
   vector<objective::Score>    score_list_;
+  unsigned                    cache_size_ = 0;
+  unsigned                    cache_hits_ = 0;
+  unsigned                    cache_misses_ = 0;
+  string                      cache_key_ = "";
+  std::list<objective::CachedScore> cache_; // most recently used first
+  std::unordered_map<string, std::list<objective::CachedScore>::iterator> cache_index_;
 };
 
 } /* namespace niwa */
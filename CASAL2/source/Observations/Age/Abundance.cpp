@@ -102,7 +102,7 @@ void Abundance::DoBuild() {
   }
 
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
 
   // Build Selectivity pointers
   for(string label : selectivity_labels_) {
@@ -143,7 +143,7 @@ void Abundance::Execute() {
   LOG_FINEST() << "Entering observation " << label_;
 
   Double expected_total = 0.0; // value in the model
-  vector<string> keys;
+  vector<unsigned> keys;
   vector<Double> expecteds;
   vector<Double> observeds;
   vector<Double> error_values;
@@ -160,7 +160,6 @@ void Abundance::Execute() {
   unsigned current_year = model_->current_year();
 
   // Loop through the obs
-  auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // auto = map<map<string, vector<partition::category&> > >
 
   if (cached_partition_->Size() != proportions_by_year_[current_year].size())
@@ -168,17 +167,17 @@ void Abundance::Execute() {
   if (partition_->Size() != proportions_by_year_[current_year].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_.size()";
 
-  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter) {
     expected_total = 0.0;
 
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (unsigned category_offset = 0; category_iter != partition_iter->end(); ++category_offset, ++cached_category_iter, ++category_iter) {
+    for (unsigned category_offset = 0; category_iter != partition_iter->end(); ++category_offset, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(proportions_index, category_offset);
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         age = (*category_iter)->min_age_ + data_offset;
 
         selectivity_result = selectivities_[category_offset]->GetAgeResult(age, (*category_iter)->age_length_);
-        start_value = (*cached_category_iter).data_[data_offset];
+        start_value = cached_data[data_offset];
         end_value = (*category_iter)->data_[data_offset];
         final_value = 0.0;
 
@@ -206,7 +205,7 @@ void Abundance::Execute() {
     error_value = error_values_by_year_[current_year];
 
     // Store the values
-    keys.push_back(category_labels_[proportions_index]);
+    keys.push_back(category_ids_[proportions_index]);
     expecteds.push_back(expected_total);
     observeds.push_back(proportions_by_year_[current_year][proportions_index]);
     error_values.push_back(error_value);
@@ -281,7 +280,7 @@ void Abundance::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         scores_[year] += comparison.score_;
       }
     }
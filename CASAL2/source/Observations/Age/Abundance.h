@@ -19,7 +19,7 @@
 
 #include "Catchabilities/Catchability.h"
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 #include "Catchabilities/Common/Nuisance.h"
 
 // Namespaces
@@ -29,7 +29,7 @@ namespace observations {
 namespace age {
 
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 using catchabilities::Nuisance;
 
 /**
@@ -58,7 +58,7 @@ protected:
   string                          catchability_label_ = "";
   Catchability*                   catchability_ = nullptr;
   Double                          process_error_value_ = 0;
-  CachedCombinedCategoriesPtr     cached_partition_;
+  SnapshotPtr                     cached_partition_;
   CombinedCategoriesPtr           partition_;
   vector<string>                  obs_;
   Double                          proportion_of_time_ = 0;
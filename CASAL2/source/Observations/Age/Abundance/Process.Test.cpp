@@ -164,7 +164,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Abundance) {
   unsigned year = 1992;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-20.151984669493967, comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.50,                comparisons[year][0].observed_);
@@ -173,7 +173,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Abundance) {
   year = 1993;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-20.148188402164081,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.1000000000000001,  comparisons[year][0].observed_);
@@ -182,7 +182,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Abundance) {
   year = 1996;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-20.135041918475192,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.53,                comparisons[year][0].observed_);
@@ -191,7 +191,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Abundance) {
   year = 1998;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-20.12878746564024,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(0.68000000000000005, comparisons[year][0].observed_);
@@ -200,7 +200,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Abundance) {
   year = 2001;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-20.123154162672272,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.23,                comparisons[year][0].observed_);
@@ -100,16 +100,17 @@ TEST_F(BasicModel, Observation_Abundance) {
   model_->Start(RunMode::kTesting);
   model_->FullIteration();
 
-  const vector<obs::Comparison>& comparisons = model_->managers().observation()->GetObservation("abundance")->comparisons(2008);
+  Observation* abundance = model_->managers().observation()->GetObservation("abundance");
+  const vector<obs::Comparison>& comparisons = abundance->comparisons(2008);
   ASSERT_EQ(2u, comparisons.size());
 
-  EXPECT_EQ("immature.male+immature.female", comparisons[0].category_);
+  EXPECT_EQ("immature.male+immature.female", abundance->comparison_category(comparisons[0].category_id_));
   EXPECT_DOUBLE_EQ(0.2, comparisons[0].error_value_);
   EXPECT_DOUBLE_EQ(142.01537476494462, comparisons[0].expected_);
   EXPECT_DOUBLE_EQ(22.5, comparisons[0].observed_);
   EXPECT_DOUBLE_EQ(40.738892086047329, comparisons[0].score_);
 
-  EXPECT_EQ("immature.female", comparisons[1].category_);
+  EXPECT_EQ("immature.female", abundance->comparison_category(comparisons[1].category_id_));
   EXPECT_DOUBLE_EQ(0.2, comparisons[1].error_value_);
   EXPECT_DOUBLE_EQ(56.806149905977861, comparisons[1].expected_);
   EXPECT_DOUBLE_EQ(11.25, comparisons[1].observed_);
@@ -128,7 +128,7 @@ void Biomass::DoBuild() {
 
 
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
 
   // Build Selectivity pointers
   for(string label : selectivity_labels_) {
@@ -173,7 +173,7 @@ void Biomass::Execute() {
   unsigned time_step_index = model_->managers().time_step()->current_time_step();
 
   Double expected_total = 0.0; // value in the model
-  vector<string> keys;
+  vector<unsigned> keys;
   vector<Double> expecteds;
   vector<Double> observeds;
   vector<Double> error_values;
@@ -190,7 +190,6 @@ void Biomass::Execute() {
   unsigned current_year = model_->current_year();
 
   // Loop through the obs
-  auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // auto = map<map<string, vector<partition::category&> > >
 
   if (cached_partition_->Size() != proportions_by_year_[current_year].size())
@@ -198,12 +197,12 @@ void Biomass::Execute() {
   if (partition_->Size() != proportions_by_year_[current_year].size())
     LOG_CODE_ERROR() << "partition_->Size() != proportions_.size()";
 
-  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned proportions_index = 0; proportions_index < proportions_by_year_[current_year].size(); ++proportions_index, ++partition_iter) {
     expected_total = 0.0;
 
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (unsigned category_offset = 0; category_iter != partition_iter->end(); ++category_offset, ++cached_category_iter, ++category_iter) {
+    for (unsigned category_offset = 0; category_iter != partition_iter->end(); ++category_offset, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(proportions_index, category_offset);
       //(*category_iter)->UpdateMeanWeightData();
       if (!parameters_.Get(PARAM_AGE_WEIGHT_LABELS)->has_been_defined()) {
         // Use the age->length->weight calculation for weight
@@ -211,7 +210,7 @@ void Biomass::Execute() {
           age = (*category_iter)->min_age_ + data_offset;
 
           selectivity_result = selectivities_[category_offset]->GetAgeResult(age, (*category_iter)->age_length_);
-          start_value = (*cached_category_iter).data_[data_offset];
+          start_value = cached_data[data_offset];
           end_value = (*category_iter)->data_[data_offset];
           final_value = 0.0;
 
@@ -231,7 +230,7 @@ void Biomass::Execute() {
           age = (*category_iter)->min_age_ + data_offset;
 
           selectivity_result = selectivities_[category_offset]->GetAgeResult(age, (*category_iter)->age_length_);
-          start_value = (*cached_category_iter).data_[data_offset];
+          start_value = cached_data[data_offset];
           end_value = (*category_iter)->data_[data_offset];
           final_value = 0.0;
 
@@ -260,7 +259,7 @@ void Biomass::Execute() {
     error_value = error_values_by_year_[current_year];
 
     // Store the values
-    keys.push_back(category_labels_[proportions_index]);
+    keys.push_back(category_ids_[proportions_index]);
     expecteds.push_back(expected_total);
     observeds.push_back(proportions_by_year_[current_year][proportions_index]);
     error_values.push_back(error_value);
@@ -325,7 +324,7 @@ void Biomass::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         scores_[year] += comparison.score_;
       }
     }
@@ -18,7 +18,7 @@
 
 #include "Catchabilities/Catchability.h"
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 #include "Catchabilities/Common/Nuisance.h"
 #include "AgeWeights/AgeWeight.h"
 
@@ -29,7 +29,7 @@ namespace observations {
 namespace age {
 
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 using catchabilities::Nuisance;
 
 /**
@@ -57,7 +57,7 @@ protected:
   string                          catchability_label_;
   Catchability*                   catchability_ = nullptr;
   Double                          process_error_value_;
-  CachedCombinedCategoriesPtr     cached_partition_;
+  SnapshotPtr                     cached_partition_;
   CombinedCategoriesPtr           partition_;
   vector<string>                  obs_;
   vector<string>                  selectivity_labels_;
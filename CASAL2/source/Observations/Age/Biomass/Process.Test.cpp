@@ -165,7 +165,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Biomass) {
   unsigned year = 1992;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-22.276816208066737,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.50,                comparisons[year][0].observed_);
@@ -174,7 +174,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Biomass) {
   year = 1993;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-22.273330558515898,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.1000000000000001,  comparisons[year][0].observed_);
@@ -183,7 +183,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Biomass) {
   year = 1996;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-22.260979027504177,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.53,                comparisons[year][0].observed_);
@@ -192,7 +192,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Biomass) {
   year = 1998;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-22.253873471029078,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(0.68000000000000005, comparisons[year][0].observed_);
@@ -201,7 +201,7 @@ TEST_F(InternalEmptyModel, Observation_Process_Biomass) {
   year = 2001;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(-22.24770655278946,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.23,                comparisons[year][0].observed_);
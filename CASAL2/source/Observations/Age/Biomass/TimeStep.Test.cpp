@@ -165,7 +165,7 @@ TEST_F(InternalEmptyModel, Observation_Biomass) {
   unsigned year = 1992;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(383.22351916713291,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.50,                comparisons[year][0].observed_);
@@ -174,7 +174,7 @@ TEST_F(InternalEmptyModel, Observation_Biomass) {
   year = 1993;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(383.15132682728552,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.1000000000000001,  comparisons[year][0].observed_);
@@ -183,7 +183,7 @@ TEST_F(InternalEmptyModel, Observation_Biomass) {
   year = 1996;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(382.90132456564459,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.53,                comparisons[year][0].observed_);
@@ -192,7 +192,7 @@ TEST_F(InternalEmptyModel, Observation_Biomass) {
   year = 1998;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(382.78238573826928,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(0.68000000000000005, comparisons[year][0].observed_);
@@ -201,7 +201,7 @@ TEST_F(InternalEmptyModel, Observation_Biomass) {
   year = 2001;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(1u, comparisons[year].size());
-  EXPECT_EQ("male+female",              comparisons[year][0].category_);
+  EXPECT_EQ("male+female",              observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0.35,                comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(382.67525910913929,  comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(1.23,                comparisons[year][0].observed_);
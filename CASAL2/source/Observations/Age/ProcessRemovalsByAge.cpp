@@ -298,7 +298,6 @@ void ProcessRemovalsByAge::Execute() {
 	if (time_step_to_execute_ == current_time_step) {
 
 		unsigned year = model_->current_year();
-		map<unsigned,map<string, map<string, vector<Double>>>> &Removals_at_age = mortality_instantaneous_->catch_at();
 
 		auto partition_iter = partition_->Begin(); // vector<vector<partition::Category> >
 		for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
@@ -310,8 +309,9 @@ void ProcessRemovalsByAge::Execute() {
 				// Go through all the fisheries and accumulate the expectation whilst also applying ageing error
 				unsigned method_offset = 0;
 				for (string fishery : method_) {
+					vector<Double>& removals = mortality_instantaneous_->removals(year, fishery, (*category_iter)->name_);
 				  // This should get caught in the DoBuild now.
-					if (Removals_at_age[year][fishery][(*category_iter)->name_].size() == 0) {
+					if (removals.size() == 0) {
 						LOG_FATAL() << "There is no catch at age data in year " << year << " for method " << fishery << " applied to category = " << (*category_iter)->name_ << " please check that your mortality_instantaneous process '" << process_label_<< "' is comparable with the observation " << label_;
 					}
 					/*
@@ -319,32 +319,32 @@ void ProcessRemovalsByAge::Execute() {
 					 */
 					if (ageing_error_label_ != "") {
 						vector < vector < Double >> &mis_matrix = ageing_error_->mis_matrix();
-						vector<Double> temp(Removals_at_age[year][fishery][(*category_iter)->name_].size(), 0.0);
+						vector<Double> temp(removals.size(), 0.0);
 						LOG_FINEST() << "category = " << (*category_iter)->name_;
-						LOG_FINEST() << "size = " << Removals_at_age[year][fishery][(*category_iter)->name_].size();
+						LOG_FINEST() << "size = " << removals.size();
 
 						for (unsigned i = 0; i < mis_matrix.size(); ++i) {
 							for (unsigned j = 0; j < mis_matrix[i].size(); ++j) {
-								temp[j] += Removals_at_age[year][fishery][(*category_iter)->name_][i] * mis_matrix[i][j];
+								temp[j] += removals[i] * mis_matrix[i][j];
 							}
 						}
-						Removals_at_age[year][fishery][(*category_iter)->name_] = temp;
+						removals = temp;
 					}
 					LOG_TRACE();
 					/*
 					 *  Now collapse the number_age into the expected_values for the observation
 					 */
-					for (unsigned k = 0; k < Removals_at_age[year][fishery][(*category_iter)->name_].size(); ++k) {
+					for (unsigned k = 0; k < removals.size(); ++k) {
 						LOG_FINE() << "----------";
 						LOG_FINE() << "Fishery: " << fishery;
-						LOG_FINE() << "Numbers At Age After Ageing error: " << (*category_iter)->min_age_ + k << "for category " << (*category_iter)->name_ << " " << Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						LOG_FINE() << "Numbers At Age After Ageing error: " << (*category_iter)->min_age_ + k << "for category " << (*category_iter)->name_ << " " << removals[k];
 
 						unsigned age_offset = min_age_ - model_->min_age();
 						if (k >= age_offset && (k - age_offset + min_age_) <= max_age_)
-						expected_values[k - age_offset] = Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						expected_values[k - age_offset] = removals[k];
 						// Deal with the plus group
 						if (((k - age_offset + min_age_) > max_age_) && plus_group_)
-						expected_values[age_spread_ - 1] += Removals_at_age[year][fishery][(*category_iter)->name_][k];
+						expected_values[age_spread_ - 1] += removals[k];
 					}
 
 					if (expected_values.size() != proportions_[model_->current_year()][category_labels_[category_offset]].size())
@@ -365,7 +365,7 @@ void ProcessRemovalsByAge::Execute() {
 			for (unsigned i = 0; i < expected_values.size(); ++i) {
 				LOG_FINEST() << "-----";
 				LOG_FINEST() << "Numbers at age for category: " << category_labels_[category_offset] << " for age " << min_age_ + i << " = " << accumulated_expected_values[i];
-				SaveComparison(category_labels_[category_offset], min_age_ + i, 0.0, accumulated_expected_values[i],
+				SaveComparison(category_ids_[category_offset], min_age_ + i, 0.0, accumulated_expected_values[i],
 				proportions_[model_->current_year()][category_labels_[category_offset]][i], process_errors_by_year_[model_->current_year()],
 				error_values_[model_->current_year()][category_labels_[category_offset]][i],0.0, delta_, 0.0);
 			}
@@ -408,7 +408,7 @@ void ProcessRemovalsByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         running_total += comparison.expected_;
       }
       for (obs::Comparison& comparison : comparisons_[year]) {
@@ -426,7 +426,7 @@ void ProcessRemovalsByAge::CalculateScore() {
       LOG_FINEST() << "-- Observation score calculation";
       LOG_FINEST() << "[" << year << "] Initial Score:" << scores_[year];
 
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: "
             << comparison.score_;
         scores_[year] += comparison.score_;
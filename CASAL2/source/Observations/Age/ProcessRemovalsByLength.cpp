@@ -286,7 +286,6 @@ void ProcessRemovalsByLength::Execute() {
   unsigned time_step = model_->managers().time_step()->current_time_step();
   auto cached_partition_iter = cached_partition_->Begin();
   auto partition_iter = partition_->Begin(); // vector<vector<partition::Category> >
-  map<unsigned, map<string, map<string, vector<Double>>>> &Removals_at_age = mortality_instantaneous_->catch_at();
 
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -318,12 +317,13 @@ void ProcessRemovalsByLength::Execute() {
 
       vector<Double> age_frequencies(length_bins_.size(), 0.0);
       const auto& age_length_proportions = model_->partition().age_length_proportions((*category_iter)->name_)[year_index][time_step];
+      const vector<Double>& removals = mortality_instantaneous_->removals(year, method_, (*category_iter)->name_);
 
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         unsigned age = ((*category_iter)->min_age_ + data_offset);
 
         // Calculate the age structure removed from the fishing process
-        number_at_age = Removals_at_age[year][method_][(*category_iter)->name_][data_offset];
+        number_at_age = removals[data_offset];
         LOG_FINEST() << "Numbers at age = " << age << " = " << number_at_age << " start value : " << start_value << " end value : " << end_value;
         // Implement an algorithm similar to DoAgeLengthConversion() to convert numbers at age to numbers at length
         // This is different to DoAgeLengthConversion as this number is now not related to the partition
@@ -372,7 +372,7 @@ void ProcessRemovalsByLength::Execute() {
        * save our comparisons so we can use them to generate the score from the likelihoods later
        */
     for (unsigned i = 0; i < expected_values.size(); ++i) {
-      SaveComparison(category_labels_[category_offset], 0, length_bins_[i], expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
+      SaveComparison(category_ids_[category_offset], 0, length_bins_[i], expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
           process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
     }
   }
@@ -404,7 +404,7 @@ void ProcessRemovalsByLength::CalculateScore() {
      */
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         running_total += comparison.expected_;
       }
       for (obs::Comparison& comparison : comparisons_[year]) {
@@ -419,7 +419,7 @@ void ProcessRemovalsByLength::CalculateScore() {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       LOG_FINEST() << "-- Observation score calculation";
       LOG_FINEST() << "[" << year << "] Initial Score:" << scores_[year];
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
         scores_[year] += comparison.score_;
       }
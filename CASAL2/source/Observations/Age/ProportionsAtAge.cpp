@@ -210,7 +210,7 @@ void ProportionsAtAge::DoValidate() {
 void ProportionsAtAge::DoBuild() {
 	LOG_TRACE();
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
 
   // Build Selectivity pointers
   for(string label : selectivity_labels_) {
@@ -267,7 +267,6 @@ void ProportionsAtAge::Execute() {
   /**
    * Verify our cached partition and partition sizes are correct
    */
-  auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
 
   /**
@@ -278,7 +277,7 @@ void ProportionsAtAge::Execute() {
   unsigned selectivity_iter = 0;
 
   LOG_FINEST() << "Number of categories " << category_labels_.size();
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter, ++selectivity_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++selectivity_iter) {
     Double      selectivity_result = 0.0;
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
@@ -292,8 +291,8 @@ void ProportionsAtAge::Execute() {
      * expected proportions values.
      */
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
     	if(selectivity_iter >= selectivities_.size())
     		LOG_CODE_ERROR() << "selectivity_iter > selectivities_.size()";
 
@@ -303,7 +302,7 @@ void ProportionsAtAge::Execute() {
         // for ages older than max_age_ that could be classified as an individual within the observation range
         unsigned age = ( (*category_iter)->min_age_ + data_offset);
         selectivity_result = selectivities_[selectivity_iter]->GetAgeResult(age, (*category_iter)->age_length_);
-        start_value   = (*cached_category_iter).data_[data_offset];
+        start_value   = cached_data[data_offset];
         end_value     = (*category_iter)->data_[data_offset];
         final_value   = 0.0;
 
@@ -366,7 +365,7 @@ void ProportionsAtAge::Execute() {
       LOG_FINEST() << "-----";
       LOG_FINEST() << "Numbers at age for all categories in age " << min_age_ + i << " = " << expected_values[i];
 
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
+      SaveComparison(category_ids_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
           process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
     }
   }
@@ -405,7 +404,7 @@ void ProportionsAtAge::CalculateScore() {
      */
     for (unsigned year : years_) {
       Double running_total = 0.0;
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         running_total += comparison.expected_;
       }
       for (obs::Comparison& comparison : comparisons_[year]) {
@@ -420,7 +419,7 @@ void ProportionsAtAge::CalculateScore() {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       LOG_FINEST() << "-- Observation score calculation " << label_;
       LOG_FINEST() << "[" << year << "] Initial Score:"<< scores_[year];
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
         scores_[year] += comparison.score_;
       }
@@ -20,7 +20,7 @@
 #include "Observations/Observation.h"
 
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 #include "Processes/Age/MortalityInstantaneous.h"
 #include "AgeingErrors/AgeingError.h"
 
@@ -31,7 +31,7 @@ namespace observations {
 namespace age {
 
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 using processes::age::MortalityInstantaneous;
 
 /**
@@ -63,7 +63,7 @@ protected:
   map<unsigned, Double>         process_errors_by_year_;
   string                        ageing_error_label_;
   parameters::Table*            error_values_table_ = nullptr;
-  CachedCombinedCategoriesPtr   cached_partition_;
+  SnapshotPtr                   cached_partition_;
   CombinedCategoriesPtr         partition_;
   AgeingError*                  ageing_error_ = nullptr;
   vector<Double>                age_results_;
@@ -220,31 +220,31 @@ TEST_F(InternalEmptyModel, Observation_Proportions_At_Length_Single) {
   unsigned year = 1992;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(5u, comparisons[year].size());
-  EXPECT_EQ("stock",                        comparisons[year][0].category_);
+  EXPECT_EQ("stock",                        observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(37,                      comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(1.3049322854316948e-008, comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(0.12,                    comparisons[year][0].observed_);
   EXPECT_DOUBLE_EQ(58.053573280444361,      comparisons[year][0].score_);
 
-  EXPECT_EQ("stock",                        comparisons[year][1].category_);
+  EXPECT_EQ("stock",                        observation->comparison_category(comparisons[year][1].category_id_));
   EXPECT_DOUBLE_EQ(37,                      comparisons[year][1].error_value_);
   EXPECT_DOUBLE_EQ(0.023617445143820383,    comparisons[year][1].expected_);
   EXPECT_DOUBLE_EQ(0.25 ,                   comparisons[year][1].observed_);
   EXPECT_DOUBLE_EQ(48.016392832372198,      comparisons[year][1].score_);
 
-  EXPECT_EQ("stock",                        comparisons[year][2].category_);
+  EXPECT_EQ("stock",                        observation->comparison_category(comparisons[year][2].category_id_));
   EXPECT_DOUBLE_EQ(37,                      comparisons[year][2].error_value_);
   EXPECT_DOUBLE_EQ(0.085102989012712807,    comparisons[year][2].expected_);
   EXPECT_DOUBLE_EQ(0.28,                    comparisons[year][2].observed_);
   EXPECT_DOUBLE_EQ(41.483073819928485,      comparisons[year][2].score_);
 
-  EXPECT_EQ("stock",                        comparisons[year][3].category_);
+  EXPECT_EQ("stock",                        observation->comparison_category(comparisons[year][3].category_id_));
   EXPECT_DOUBLE_EQ(37,                      comparisons[year][3].error_value_);
   EXPECT_DOUBLE_EQ(0.59473940098840894,     comparisons[year][3].expected_);
   EXPECT_DOUBLE_EQ(0.25,                    comparisons[year][3].observed_);
   EXPECT_DOUBLE_EQ(18.174619217398927,      comparisons[year][3].score_);
 
-  EXPECT_EQ("stock",                        comparisons[year][4].category_);
+  EXPECT_EQ("stock",                        observation->comparison_category(comparisons[year][4].category_id_));
   EXPECT_DOUBLE_EQ(37,                      comparisons[year][4].error_value_);
   EXPECT_DOUBLE_EQ(0.29654015180573506,     comparisons[year][4].expected_);
   EXPECT_DOUBLE_EQ(0.1,                     comparisons[year][4].observed_);
@@ -391,31 +391,31 @@ TEST_F(InternalEmptyModel, Observation_Proportions_At_Length_Double) {
 //  unsigned year = 1992;
 //  ASSERT_FALSE(comparisons.find(year) == comparisons.end());
 //  ASSERT_EQ(26u, comparisons[year].size());
-//  EXPECT_EQ("male",                       comparisons[year][0].category_);
+//  EXPECT_EQ("male",                       observation->comparison_category(comparisons[year][0].category_id_));
 //  EXPECT_DOUBLE_EQ(1.091,                 comparisons[year][0].error_value_);
 //  EXPECT_DOUBLE_EQ(0.0041584607534975501, comparisons[year][0].expected_);
 //  EXPECT_DOUBLE_EQ(0.0173,                comparisons[year][0].observed_);
 //  EXPECT_DOUBLE_EQ(1.9851433023156135,    comparisons[year][0].score_);
 //
-//  EXPECT_EQ("male",                       comparisons[year][1].category_);
+//  EXPECT_EQ("male",                       observation->comparison_category(comparisons[year][1].category_id_));
 //  EXPECT_DOUBLE_EQ(0.770,                 comparisons[year][1].error_value_);
 //  EXPECT_DOUBLE_EQ(0.0070171259680794212, comparisons[year][1].expected_);
 //  EXPECT_DOUBLE_EQ(0.0193,                comparisons[year][1].observed_);
 //  EXPECT_DOUBLE_EQ(1.2811829881419403,    comparisons[year][1].score_);
 //
-//  EXPECT_EQ("male",                       comparisons[year][2].category_);
+//  EXPECT_EQ("male",                       observation->comparison_category(comparisons[year][2].category_id_));
 //  EXPECT_DOUBLE_EQ(0.539,                 comparisons[year][2].error_value_);
 //  EXPECT_DOUBLE_EQ(0.011682048742702372,  comparisons[year][2].expected_);
 //  EXPECT_DOUBLE_EQ(0.0241,                comparisons[year][2].observed_);
 //  EXPECT_DOUBLE_EQ(0.73886489332777494,   comparisons[year][2].score_);
 //
-//  EXPECT_EQ("male",                       comparisons[year][3].category_);
+//  EXPECT_EQ("male",                       observation->comparison_category(comparisons[year][3].category_id_));
 //  EXPECT_DOUBLE_EQ(0.421,                 comparisons[year][3].error_value_);
 //  EXPECT_DOUBLE_EQ(0.018938077956547807,  comparisons[year][3].expected_);
 //  EXPECT_DOUBLE_EQ(0.0346,                comparisons[year][3].observed_);
 //  EXPECT_DOUBLE_EQ(0.52825882781144118,   comparisons[year][3].score_);
 //
-//  EXPECT_EQ("male",                       comparisons[year][4].category_);
+//  EXPECT_EQ("male",                       observation->comparison_category(comparisons[year][4].category_id_));
 //  EXPECT_DOUBLE_EQ(0.412,                 comparisons[year][4].error_value_);
 //  EXPECT_DOUBLE_EQ(0.029222930328445654,  comparisons[year][4].expected_);
 //  EXPECT_DOUBLE_EQ(0.0365,                comparisons[year][4].observed_);
@@ -225,9 +225,9 @@ void ProportionsByCategory::DoValidate() {
  */
 void ProportionsByCategory::DoBuild() {
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
   target_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, target_category_labels_));
-  target_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, target_category_labels_));
+  target_cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, target_category_labels_));
 
 
   if (ageing_error_label_ != "")
@@ -284,9 +284,7 @@ void ProportionsByCategory::Execute() {
   /**
    * Verify our cached partition and partition sizes are correct
    */
-  auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
-  auto target_cached_partition_iter  = target_cached_partition_->Begin();
   auto target_partition_iter         = target_partition_->Begin(); // vector<vector<partition::Category> >
 
   /**
@@ -294,7 +292,7 @@ void ProportionsByCategory::Execute() {
    * with it. We need to build a vector of proportions for each age using that combination and then
    * compare it to the observations.
    */
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
     Double      selectivity_result = 0.0;
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
@@ -308,8 +306,8 @@ void ProportionsByCategory::Execute() {
      * age results proportions values.
      */
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         // Check and skip ages we don't care about.
         if ((*category_iter)->min_age_ + data_offset < min_age_)
@@ -331,7 +329,7 @@ void ProportionsByCategory::Execute() {
         LOG_FINE() << "---------------";
         LOG_FINE() << "age: " << age;
         selectivity_result = selectivities_[category_offset]->GetAgeResult(age, (*category_iter)->age_length_);
-        start_value   = (*cached_category_iter).data_[data_offset];
+        start_value   = cached_data[data_offset];
         end_value     = (*category_iter)->data_[data_offset];
         final_value   = 0.0;
 
@@ -356,8 +354,8 @@ void ProportionsByCategory::Execute() {
      * target age results
      */
     auto target_category_iter = target_partition_iter->begin();
-    auto target_cached_category_iter = target_cached_partition_iter->begin();
-    for (; target_category_iter != target_partition_iter->end(); ++target_cached_category_iter, ++target_category_iter) {
+    for (unsigned target_category_index = 0; target_category_iter != target_partition_iter->end(); ++target_category_index, ++target_category_iter) {
+      const Double* target_cached_data = target_cached_partition_->data(0, target_category_index);
       for (unsigned data_offset = 0; data_offset < (*target_category_iter)->data_.size(); ++data_offset) {
         // Check and skip ages we don't care about.
         if ((*target_category_iter)->min_age_ + data_offset < min_age_)
@@ -375,7 +373,7 @@ void ProportionsByCategory::Execute() {
           break;
 
         selectivity_result = target_selectivities_[category_offset]->GetAgeResult(age, (*target_category_iter)->age_length_);
-        start_value   = (*target_cached_category_iter).data_[data_offset];
+        start_value   = target_cached_data[data_offset];
         end_value     = (*target_category_iter)->data_[data_offset];
         final_value   = 0.0;
 
@@ -408,7 +406,7 @@ void ProportionsByCategory::Execute() {
       if (age_results[i] != 0.0)
         expected = target_age_results[i] / age_results[i];
 
-      SaveComparison(category_labels_[category_offset], min_age_ + i, 0, expected, proportions_[model_->current_year()][category_labels_[category_offset]][i],
+      SaveComparison(category_ids_[category_offset], min_age_ + i, 0, expected, proportions_[model_->current_year()][category_labels_[category_offset]][i],
           process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
     }
   }
@@ -433,7 +431,7 @@ void ProportionsByCategory::CalculateScore() {
      */
     for (unsigned year : years_) {
 //      Double running_total = 0.0;
-//      for (obs::Comparison comparison : comparisons_[year]) {
+//      for (const obs::Comparison& comparison : comparisons_[year]) {
 //        running_total += comparison.expected_;
 //      }
 //      for (obs::Comparison& comparison : comparisons_[year]) {
@@ -445,7 +443,7 @@ void ProportionsByCategory::CalculateScore() {
 
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
       likelihood_->GetScores(comparisons_);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         scores_[year] += comparison.score_;
       }
     }
@@ -18,7 +18,7 @@
 #include "Observations/Observation.h"
 
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 
 // Namespace
 namespace niwa {
@@ -27,7 +27,7 @@ namespace observations {
 namespace age {
 
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 
 /**
  * Class definition
@@ -60,9 +60,9 @@ protected:
   map<unsigned, Double>         process_errors_by_year_;
   string                        ageing_error_label_;
   parameters::Table*            error_values_table_ = nullptr;
-  CachedCombinedCategoriesPtr   cached_partition_;
+  SnapshotPtr                   cached_partition_;
   CombinedCategoriesPtr         partition_;
-  CachedCombinedCategoriesPtr   target_cached_partition_;
+  SnapshotPtr                   target_cached_partition_;
   CombinedCategoriesPtr         target_partition_;
   vector<Double>                age_results_;
   vector<Selectivity*>          target_selectivities_;
@@ -224,37 +224,62 @@ TEST_F(InternalEmptyModel, Observation_Proportions_Mature_By_Age) {
   unsigned year = 1994;
   ASSERT_FALSE(comparisons.find(year) == comparisons.end());
   ASSERT_EQ(80u, comparisons[year].size());
-  EXPECT_EQ("spawn",                      comparisons[year][0].category_);
+  EXPECT_EQ("spawn",                      observation->comparison_category(comparisons[year][0].category_id_));
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][0].error_value_);
   EXPECT_DOUBLE_EQ(2.5188981851903107e-008,comparisons[year][0].expected_);
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][0].observed_);
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][0].score_);
 
-  EXPECT_EQ("spawn",                      comparisons[year][10].category_);
+  EXPECT_EQ("spawn",                      observation->comparison_category(comparisons[year][10].category_id_));
   EXPECT_DOUBLE_EQ(5,                     comparisons[year][10].error_value_);
   EXPECT_DOUBLE_EQ(1.360804113049925e-005,comparisons[year][10].expected_);
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][10].observed_);
   EXPECT_DOUBLE_EQ(6.8040668603589396e-005,comparisons[year][10].score_);
 
-  EXPECT_EQ("spawn",                      comparisons[year][20].category_);
+  EXPECT_EQ("spawn",                      observation->comparison_category(comparisons[year][20].category_id_));
   EXPECT_DOUBLE_EQ(9,                     comparisons[year][20].error_value_);
   EXPECT_DOUBLE_EQ(0.0085862448973253094, comparisons[year][20].expected_);
   EXPECT_DOUBLE_EQ(0.1111111,             comparisons[year][20].observed_);
   EXPECT_DOUBLE_EQ(2.6293554588266024,     comparisons[year][20].score_);
 
-  EXPECT_EQ("spawn",                      comparisons[year][30].category_);
+  EXPECT_EQ("spawn",                      observation->comparison_category(comparisons[year][30].category_id_));
   EXPECT_DOUBLE_EQ(5,                     comparisons[year][30].error_value_);
   EXPECT_DOUBLE_EQ(0.80328300099950134,    comparisons[year][30].expected_);
   EXPECT_DOUBLE_EQ(0.80000000000000004,   comparisons[year][30].observed_);
   EXPECT_DOUBLE_EQ(0.89274401388247926,    comparisons[year][30].score_);
 
-  EXPECT_EQ("spawn",                      comparisons[year][70].category_);
+  EXPECT_EQ("spawn",                      observation->comparison_category(comparisons[year][70].category_id_));
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][70].error_value_);
   EXPECT_DOUBLE_EQ(1,                     comparisons[year][70].expected_);
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][70].observed_);
   EXPECT_DOUBLE_EQ(0,                     comparisons[year][70].score_);
 }
 
+/**
+ * Check running the model again reuses the memory of the comparisons
+ * and gives the same score
+ */
+TEST_F(InternalEmptyModel, Observation_Proportions_Mature_By_Age_Reuses_Comparisons) {
+  AddConfigurationLine(test_cases_observation_proportions_mature_by_age_age_single, __FILE__, 31);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  ObjectiveFunction& obj_function = model_->objective_function();
+  Observation* observation = model_->managers().observation()->GetObservation("Mature_1994");
+  vector<obs::Comparison>& comparisons = observation->comparisons(1994);
+  ASSERT_EQ(80u, comparisons.size());
+  const obs::Comparison* first_comparison = comparisons.data();
+
+  model_->FullIteration();
+  obj_function.CalculateScore();
+  EXPECT_DOUBLE_EQ(133.52090147835676, obj_function.score());
+  ASSERT_EQ(1u, observation->comparisons().size());
+  ASSERT_EQ(80u, comparisons.size());
+  EXPECT_EQ(first_comparison, comparisons.data());
+  EXPECT_EQ("spawn", observation->comparison_category(comparisons[20].category_id_));
+}
+
 } /* namespace processes */
 } /* namespace niwa */
 
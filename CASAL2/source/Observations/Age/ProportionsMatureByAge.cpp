@@ -231,11 +231,11 @@ void ProportionsMatureByAge::DoBuild() {
   LOG_TRACE();
   // Get all categories in the system.
   total_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, total_category_labels_));
-  total_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, total_category_labels_));
+  total_cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, total_category_labels_));
 
   // all categories
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
 
   // Create a pointer to misclassification matrix
   if( ageing_error_label_ != "") {
@@ -290,9 +290,7 @@ void ProportionsMatureByAge::Execute() {
   /**
    * Verify our cached partition and partition sizes are correct
    */
-  auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin();
-  auto total_cached_partition_iter  = total_cached_partition_->Begin();
   auto total_partition_iter         = total_partition_->Begin();
   /**
    * Loop through the provided categories. Each provided category (combination) will have a list of observations
@@ -300,7 +298,7 @@ void ProportionsMatureByAge::Execute() {
    * compare it to the observations.
    */
   LOG_FINEST() << "Number of categories " << category_labels_.size();
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
 
@@ -312,14 +310,14 @@ void ProportionsMatureByAge::Execute() {
      * Loop through the total categories building up numbers at age.
      */
     auto total_category_iter = total_partition_iter->begin();
-    auto total_cached_category_iter = total_cached_partition_iter->begin();
-    for (; total_category_iter != total_partition_iter->end(); ++total_cached_category_iter, ++total_category_iter) {
+    for (unsigned total_category_index = 0; total_category_iter != total_partition_iter->end(); ++total_category_index, ++total_category_iter) {
+      const Double* total_cached_data = total_cached_partition_->data(0, total_category_index);
       for (unsigned data_offset = 0; data_offset < (*total_category_iter)->data_.size(); ++data_offset) {
         // We now need to loop through all ages to apply ageing misclassification matrix to account
         // for ages older than max_age_ that could be classified as an individual within the observation range
         unsigned age = ( (*total_category_iter)->min_age_ + data_offset);
 
-        start_value   = (*total_cached_category_iter).data_[data_offset];
+        start_value   = total_cached_data[data_offset];
         end_value     = (*total_category_iter)->data_[data_offset];
 
         total_numbers_age[data_offset] += start_value + (end_value - start_value) * time_step_proportion_;
@@ -333,14 +331,14 @@ void ProportionsMatureByAge::Execute() {
      * Loop through the categories building up numbers at age for the mature, but also adding them onto the total .
      */
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         // We now need to loop through all ages to apply ageing misclassification matrix to account
         // for ages older than max_age_ that could be classified as an individual within the observation range
         unsigned age = ( (*category_iter)->min_age_ + data_offset);
 
-        start_value   = (*cached_category_iter).data_[data_offset];
+        start_value   = cached_data[data_offset];
         end_value     = (*category_iter)->data_[data_offset];
 
         numbers_age[data_offset] += start_value + (end_value - start_value) * time_step_proportion_;
@@ -413,7 +411,7 @@ void ProportionsMatureByAge::Execute() {
      */
     for (unsigned i = 0; i < expected_values.size(); ++i) {
       LOG_FINEST() << "proportions mature at age " << min_age_ + i << " = " << expected_values[i];
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
+      SaveComparison(category_ids_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
           process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
     }
   }
@@ -440,7 +438,7 @@ void ProportionsMatureByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
         scores_[year] += comparison.score_;
       }
@@ -19,7 +19,7 @@
 #include "Observations/Observation.h"
 
 #include "Partition/Accessors/CombinedCategories.h"
-#include "Partition/Accessors/Cached/CombinedCategories.h"
+#include "Partition/Accessors/Cached/Snapshot.h"
 #include "AgeingErrors/AgeingError.h"
 
 // Namespace
@@ -28,7 +28,7 @@ namespace observations {
 namespace age {
 
 using partition::accessors::CombinedCategoriesPtr;
-using partition::accessors::cached::CachedCombinedCategoriesPtr;
+using partition::accessors::cached::SnapshotPtr;
 
 
 /**
@@ -60,10 +60,10 @@ protected:
   map<unsigned, Double>         process_errors_by_year_;
   string                        ageing_error_label_;
   parameters::Table*            error_values_table_ = nullptr;
-  CachedCombinedCategoriesPtr   cached_partition_;
+  SnapshotPtr                   cached_partition_;
   CombinedCategoriesPtr         partition_;
   vector<string>                total_category_labels_;
-  CachedCombinedCategoriesPtr   total_cached_partition_;
+  SnapshotPtr                   total_cached_partition_;
   CombinedCategoriesPtr         total_partition_;
   Double                        time_step_proportion_;
   AgeingError*                  ageing_error_ = nullptr;
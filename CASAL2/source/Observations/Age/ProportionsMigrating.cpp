@@ -193,7 +193,7 @@ void ProportionsMigrating::DoValidate() {
  */
 void ProportionsMigrating::DoBuild() {
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
 
 // Create a pointer to misclassification matrix
   if( ageing_error_label_ != "") {
@@ -241,7 +241,6 @@ void ProportionsMigrating::Execute() {
   /**
    * Verify our cached partition and partition sizes are correct
    */
-  auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
 
   /**
@@ -250,7 +249,7 @@ void ProportionsMigrating::Execute() {
    * compare it to the observations.
    */
   LOG_FINEST() << "Number of categories " << category_labels_.size();
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
 
@@ -264,14 +263,14 @@ void ProportionsMigrating::Execute() {
      * expected proportions values.
      */
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         // We now need to loop through all ages to apply ageing misclassification matrix to account
         // for ages older than max_age_ that could be classified as an individual within the observation range
         unsigned age = ( (*category_iter)->min_age_ + data_offset);
 
-        start_value   = (*cached_category_iter).data_[data_offset];
+        start_value   = cached_data[data_offset];
         end_value     = (*category_iter)->data_[data_offset];
 
         numbers_age_before[data_offset] += start_value;
@@ -343,7 +342,7 @@ void ProportionsMigrating::Execute() {
 
     for (unsigned i = 0; i < expected_values.size(); ++i) {
       LOG_FINEST() << " Numbers at age " << min_age_ + i << " = " << expected_values[i];
-      SaveComparison(category_labels_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
+      SaveComparison(category_ids_[category_offset], min_age_ + i ,0.0 ,expected_values[i], proportions_[model_->current_year()][category_labels_[category_offset]][i],
           process_errors_by_year_[model_->current_year()], error_values_[model_->current_year()][category_labels_[category_offset]][i], 0.0, delta_, 0.0);
     }
   }
@@ -370,7 +369,7 @@ void ProportionsMigrating::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         LOG_FINEST() << "[" << year << "]+ likelihood score: " << comparison.score_;
         scores_[year] += comparison.score_;
       }
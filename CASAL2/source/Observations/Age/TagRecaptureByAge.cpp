@@ -211,9 +211,9 @@ void TagRecaptureByAge::DoValidate() {
  */
 void TagRecaptureByAge::DoBuild() {
   partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, category_labels_));
-  cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, category_labels_));
+  cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, category_labels_));
   target_partition_ = CombinedCategoriesPtr(new niwa::partition::accessors::CombinedCategories(model_, target_category_labels_));
-  target_cached_partition_ = CachedCombinedCategoriesPtr(new niwa::partition::accessors::cached::CombinedCategories(model_, target_category_labels_));
+  target_cached_partition_ = SnapshotPtr(new niwa::partition::accessors::cached::Snapshot(model_, target_category_labels_));
 
   if (ageing_error_label_ != "") {
     LOG_CODE_ERROR() << "ageing error has not been implemented for the tag recapture at age observation";
@@ -285,9 +285,7 @@ void TagRecaptureByAge::Execute() {
   /**
    * Verify our cached partition and partition sizes are correct
    */
-  auto cached_partition_iter  = cached_partition_->Begin();
   auto partition_iter         = partition_->Begin(); // vector<vector<partition::Category> >
-  auto target_cached_partition_iter  = target_cached_partition_->Begin();
   auto target_partition_iter         = target_partition_->Begin(); // vector<vector<partition::Category> >
 
   /**
@@ -295,7 +293,7 @@ void TagRecaptureByAge::Execute() {
    * with it. We need to build a vector of proportions for each age using that combination and then
    * compare it to the observations.
    */
-  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter, ++cached_partition_iter) {
+  for (unsigned category_offset = 0; category_offset < category_labels_.size(); ++category_offset, ++partition_iter) {
     Double      selectivity_result = 0.0;
     Double      start_value        = 0.0;
     Double      end_value          = 0.0;
@@ -309,8 +307,8 @@ void TagRecaptureByAge::Execute() {
      * age results proportions values.
      */
     auto category_iter = partition_iter->begin();
-    auto cached_category_iter = cached_partition_iter->begin();
-    for (; category_iter != partition_iter->end(); ++cached_category_iter, ++category_iter) {
+    for (unsigned category_index = 0; category_iter != partition_iter->end(); ++category_index, ++category_iter) {
+      const Double* cached_data = cached_partition_->data(category_offset, category_index);
       for (unsigned data_offset = 0; data_offset < (*category_iter)->data_.size(); ++data_offset) {
         // Check and skip ages we don't care about.
         if ((*category_iter)->min_age_ + data_offset < min_age_)
@@ -332,7 +330,7 @@ void TagRecaptureByAge::Execute() {
         LOG_FINE() << "---------------";
         LOG_FINE() << "age: " << age;
         selectivity_result = selectivities_[category_offset]->GetAgeResult(age, (*category_iter)->age_length_);
-        start_value   = (*cached_category_iter).data_[data_offset];
+        start_value   = cached_data[data_offset];
         end_value     = (*category_iter)->data_[data_offset];
         final_value   = 0.0;
 
@@ -358,8 +356,8 @@ void TagRecaptureByAge::Execute() {
      * target age results
      */
     auto target_category_iter = target_partition_iter->begin();
-    auto target_cached_category_iter = target_cached_partition_iter->begin();
-    for (; target_category_iter != target_partition_iter->end(); ++target_cached_category_iter, ++target_category_iter) {
+    for (unsigned target_category_index = 0; target_category_iter != target_partition_iter->end(); ++target_category_index, ++target_category_iter) {
+      const Double* target_cached_data = target_cached_partition_->data(0, target_category_index);
       for (unsigned data_offset = 0; data_offset < (*target_category_iter)->data_.size(); ++data_offset) {
         // Check and skip ages we don't care about.
         if ((*target_category_iter)->min_age_ + data_offset < min_age_)
@@ -377,7 +375,7 @@ void TagRecaptureByAge::Execute() {
           break;
 
         selectivity_result = target_selectivities_[category_offset]->GetAgeResult(age, (*target_category_iter)->age_length_);
-        start_value   = (*target_cached_category_iter).data_[data_offset];
+        start_value   = target_cached_data[data_offset];
         end_value     = (*target_category_iter)->data_[data_offset];
         final_value   = 0.0;
 
@@ -442,7 +440,7 @@ void TagRecaptureByAge::CalculateScore() {
 
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         scores_[year] += comparison.score_;
       }
     }
@@ -453,7 +453,7 @@ void TagRecaptureByLength::CalculateScore() {
     likelihood_->GetScores(comparisons_);
     for (unsigned year : years_) {
       scores_[year] = likelihood_->GetInitialScore(comparisons_, year);
-      for (obs::Comparison comparison : comparisons_[year]) {
+      for (const obs::Comparison& comparison : comparisons_[year]) {
         scores_[year] += comparison.score_;
       }
       // Add the dispersion factor to the likelihood score
@@ -8,25 +8,26 @@
  *
  * @section DESCRIPTION
  *
- * << Add Description >>
+ * A single comparison between an expected and observed value.
+ *
+ * Comparisons are created on every model evaluation so the struct only
+ * holds plain values. The category is stored as an id that is looked up
+ * with Observation::comparison_category() when a label is needed.
  */
 #ifndef OBSERVATIONS_COMPARISON_H_
 #define OBSERVATIONS_COMPARISON_H_
 
 // headers
-#include <string>
-
 #include "Utilities/Types.h"
 
 // namespaces
 namespace niwa {
 namespace observations {
 
-using std::string;
 using utilities::Double;
 
 struct Comparison {
-  string    category_ = "";
+  unsigned  category_id_ = 0;
   unsigned  age_ = 0;
   Double    length_ = 0;
   Double    expected_ = 0;
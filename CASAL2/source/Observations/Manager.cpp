@@ -13,6 +13,8 @@
 // Headers
 #include "Manager.h"
 
+#include "Model/Model.h"
+
 // Namespaces
 namespace niwa {
 namespace observations {
@@ -20,7 +22,7 @@ namespace observations {
 /**
  * Default Constructor
  */
-Manager::Manager() {
+Manager::Manager(Model* model) : model_(model) {
 }
 
 /**
@@ -75,6 +77,7 @@ Observation* Manager::GetObservation(const string& label) {
  */
 void Manager::CalculateScores() {
   for (auto observation : objects_) {
+    Timings::Timer timer(model_->timings(), observation, PARAM_OBSERVATION, Timings::Method::kCalculateScore);
     observation->CalculateScore();
   }
 }
@@ -36,7 +36,12 @@ public:
 
 protected:
   // methods
-  Manager();
+  Manager() = delete;
+  explicit Manager(Model* model);
+
+private:
+  // members
+  Model*                      model_;
 };
 
 } /* namespace observations */
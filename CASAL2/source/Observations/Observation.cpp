@@ -23,6 +23,7 @@
 #include "Likelihoods/Manager.h"
 #include "Model/Managers.h"
 #include "Model/Model.h"
+#include "Utilities/To.h"
 
 // Namespaces
 namespace niwa {
@@ -98,33 +99,119 @@ void Observation::Build() {
   }
 
   DoBuild();
+
+  category_ids_.clear();
+  for (const string& category_label : category_labels_)
+    category_ids_.push_back(ComparisonCategoryId(category_label));
 }
 
 /**
- * Reset our observation so it can be called again
+ * Reset our observation so it can be called again.
+ *
+ * The comparisons for each year are emptied but keep their memory
+ * so the next evaluation does not need to allocate.
  */
 void Observation::Reset() {
-  comparisons_.clear();
+  for (auto& iter : comparisons_)
+    iter.second.clear();
   scores_.clear();
 
   DoReset();
 }
 
+/**
+ * Save the comparisons made so far. Each comparison is stored as a
+ * row of values starting with the category id.
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void Observation::SaveState(Checkpoint& checkpoint) const {
+  vector<Double> years;
+  for (auto& iter : comparisons_) {
+    years.push_back(Double(iter.first));
+    vector<Double> values;
+    for (const obs::Comparison& comparison : iter.second) {
+      values.insert(values.end(), { Double(comparison.category_id_), Double(comparison.age_), comparison.length_, comparison.expected_, comparison.observed_,
+          comparison.error_value_, comparison.process_error_, comparison.adjusted_error_, comparison.delta_, comparison.score_ });
+    }
+
+    string key = "observation[" + label_ + "].comparisons." + utilities::ToInline<unsigned, string>(iter.first);
+    checkpoint.Save(key, values);
+  }
+  checkpoint.Save("observation[" + label_ + "].comparisons", years);
+}
+
+/**
+ * Restore the comparisons saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void Observation::RestoreState(const Checkpoint& checkpoint) {
+  for (auto& iter : comparisons_)
+    iter.second.clear();
+  vector<Double> years;
+  checkpoint.Restore("observation[" + label_ + "].comparisons", years);
+  for (Double& year_value : years) {
+    unsigned year = (unsigned)AS_DOUBLE(year_value);
+    string key = "observation[" + label_ + "].comparisons." + utilities::ToInline<unsigned, string>(year);
+    vector<Double> values;
+    checkpoint.Restore(key, values);
+    if (values.size() % 10 != 0)
+      LOG_CODE_ERROR() << "The checkpoint for " << key << " has " << values.size() << " values which is not a whole number of comparisons";
+
+    vector<obs::Comparison>& comparisons = comparisons_[year];
+    comparisons.resize(values.size() / 10);
+    for (unsigned i = 0; i < comparisons.size(); ++i) {
+      const Double* value = &values[i * 10];
+      obs::Comparison& comparison = comparisons[i];
+      comparison.category_id_    = (unsigned)AS_DOUBLE(value[0]);
+      comparison.age_            = (unsigned)AS_DOUBLE(value[1]);
+      comparison.length_         = value[2];
+      comparison.expected_       = value[3];
+      comparison.observed_       = value[4];
+      comparison.error_value_    = value[5];
+      comparison.process_error_  = value[6];
+      comparison.adjusted_error_ = value[7];
+      comparison.delta_          = value[8];
+      comparison.score_          = value[9];
+    }
+  }
+}
+
+/**
+ * Find the id used by the comparisons for a category label. Labels
+ * that have not been seen before are given the next id.
+ *
+ * @param category The category label
+ * @return The id of the category
+ */
+unsigned Observation::ComparisonCategoryId(const string& category) {
+  for (unsigned i = 0; i < comparison_categories_.size(); ++i) {
+    if (comparison_categories_[i] == category)
+      return i;
+  }
+
+  comparison_categories_.push_back(category);
+  return comparison_categories_.size() - 1;
+}
+
 /**
  * Save the comparison that was done during an observation to the list of comparisons. Each comparison contributes part to a score
  * and we will need to know what those parts are when reporting.
  *
- * @param category The name of the comparison
+ * @param category_id The id of the category from ComparisonCategoryId()
  * @param age The age of the population being compared
  * @param expected The value generated by the model
  * @param observed The value passed in from the configuration file
  * @param error_value The error value for this comparison
  * @param score The amount of score for this comparison
  */
-void Observation::SaveComparison(string category, unsigned age, Double length, Double expected, Double observed,
+void Observation::SaveComparison(unsigned category_id, unsigned age, Double length, Double expected, Double observed,
     Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
-  observations::Comparison new_comparison;
-  new_comparison.category_ = category;
+  vector<obs::Comparison>& comparisons = comparisons_[model_->current_year()];
+  comparisons.emplace_back();
+  obs::Comparison& new_comparison = comparisons.back();
+  new_comparison.category_id_ = category_id;
   new_comparison.age_ = age;
   new_comparison.length_ = length;
   new_comparison.expected_ = expected;
@@ -134,7 +221,6 @@ void Observation::SaveComparison(string category, unsigned age, Double length, D
   new_comparison.adjusted_error_ = adjusted_error;
   new_comparison.delta_ = delta;
   new_comparison.score_ = score;
-  comparisons_[model_->current_year()].push_back(new_comparison);
 }
 
 /**
@@ -148,9 +234,39 @@ void Observation::SaveComparison(string category, unsigned age, Double length, D
  * @param error_value The error value for this comparison
  * @param score The amount of score for this comparison
  */
-void Observation::SaveComparison(string category, Double expected, Double observed,
+void Observation::SaveComparison(const string& category, unsigned age, Double length, Double expected, Double observed,
+    Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
+  SaveComparison(ComparisonCategoryId(category), age, length, expected, observed, process_error, error_value, adjusted_error, delta, score);
+}
+
+/**
+ * Save the comparison that was done during an observation to the list of comparisons. Each comparison contributes part to a score
+ * and we will need to know what those parts are when reporting.
+ *
+ * @param category_id The id of the category from ComparisonCategoryId()
+ * @param expected The value generated by the model
+ * @param observed The value passed in from the configuration file
+ * @param error_value The error value for this comparison
+ * @param score The amount of score for this comparison
+ */
+void Observation::SaveComparison(unsigned category_id, Double expected, Double observed,
+    Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
+  SaveComparison(category_id, 0, 0, expected, observed, process_error, error_value,adjusted_error, delta, score);
+}
+
+/**
+ * Save the comparison that was done during an observation to the list of comparisons. Each comparison contributes part to a score
+ * and we will need to know what those parts are when reporting.
+ *
+ * @param category The name of the comparison
+ * @param expected The value generated by the model
+ * @param observed The value passed in from the configuration file
+ * @param error_value The error value for this comparison
+ * @param score The amount of score for this comparison
+ */
+void Observation::SaveComparison(const string& category, Double expected, Double observed,
     Double process_error, Double error_value, Double adjusted_error, Double delta, Double score) {
-  SaveComparison(category, 0, 0, expected, observed, process_error, error_value,adjusted_error, delta, score);
+  SaveComparison(ComparisonCategoryId(category), 0, 0, expected, observed, process_error, error_value,adjusted_error, delta, score);
 }
 
 } /* namespace niwa */
@@ -19,6 +19,7 @@
 // Headers
 #include "BaseClasses/Executor.h"
 #include "Likelihoods/Likelihood.h"
+#include "Model/Checkpoint.h"
 #include "Observations/Comparison.h"
 #include "Utilities/Types.h"
 
@@ -43,6 +44,8 @@ public:
   void                        Validate();
   void                        Build();
   void                        Reset();
+  void                        SaveState(Checkpoint& checkpoint) const;
+  void                        RestoreState(const Checkpoint& checkpoint);
 
   // pure methods
   virtual void                DoValidate() = 0;
@@ -56,13 +59,21 @@ public:
   string&                       likelihood() { return likelihood_type_; }
   vector<obs::Comparison>&      comparisons(unsigned year) { return comparisons_[year]; }
   map<unsigned, vector<obs::Comparison> >& comparisons() { return comparisons_; }
+  const string&                 comparison_category(unsigned category_id) const { return comparison_categories_[category_id]; }
 
 protected:
   // methods
-  void                        SaveComparison(string category, unsigned age, Double length, Double expected, Double observed,
+  unsigned                    ComparisonCategoryId(const string& category);
+  void                        SaveComparison(unsigned category_id, unsigned age, Double length, Double expected, Double observed,
       Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
 
-  void                        SaveComparison(string category, Double expected, Double observed,
+  void                        SaveComparison(const string& category, unsigned age, Double length, Double expected, Double observed,
+      Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
+
+  void                        SaveComparison(unsigned category_id, Double expected, Double observed,
+      Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
+
+  void                        SaveComparison(const string& category, Double expected, Double observed,
       Double process_error, Double error_value, Double adjusted_error, Double delta, Double score);
 
   // members
@@ -79,8 +90,10 @@ protected:
   Double                      error_value_multiplier_ = 1.0;
   Double                      likelihood_multiplier_ = 1.0;
   vector<string>              category_labels_;
+  vector<unsigned>            category_ids_;
   unsigned                    expected_selectivity_count_;
   map<unsigned, vector<obs::Comparison> > comparisons_;
+  vector<string>              comparison_categories_;
 
 };
 } /* namespace niwa */
@@ -265,6 +265,30 @@ parameters::Table* ParameterList::GetTable(const string& label) {
   return iter->second;
 }
 
+/**
+ * Check if any of our parameters or tables have been given this value.
+ * This is used to find out which objects reference another object by label.
+ *
+ * @param value The value to look for
+ * @return true if the value was found, false otherwise
+ */
+bool ParameterList::HasValue(const string& value) {
+  for (auto& iter : parameters_) {
+    const vector<string>& values = iter.second->values();
+    if (std::find(values.begin(), values.end(), value) != values.end())
+      return true;
+  }
+
+  for (auto& iter : tables_) {
+    for (auto& row : iter.second->data()) {
+      if (std::find(row.begin(), row.end(), value) != row.end())
+        return true;
+    }
+  }
+
+  return false;
+}
+
 /**
  * This method will copy all of the parameters from
  * the source parameter list into this parameter list.
@@ -93,6 +93,7 @@ public:
   bool                        Add(const string& label, const vector<string>& values, const string& file_name, const unsigned& line_number);
   Parameter*                  Get(const string& label);
   parameters::Table*          GetTable(const string& label);
+  bool                        HasValue(const string& value);
   void                        CopyFrom(const ParameterList& source, string parameter_label);
   void                        CopyFrom(const ParameterList& source, string parameter_label, const unsigned &value_index);
   void                        Clear();
@@ -0,0 +1,121 @@
+/**
+ * @file Snapshot.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @version 1.0
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
+ */
+#ifdef TESTMODE
+
+// headers
+#include "Snapshot.h"
+
+#include "Model/Factory.h"
+#include "TimeSteps/Manager.h"
+#include "Partition/Partition.h"
+#include "TestResources/TestFixtures/BasicModel.h"
+
+// namespaces
+namespace niwa {
+namespace partition {
+namespace accessors {
+namespace cached {
+
+using niwa::testfixtures::BasicModel;
+
+/**
+ *
+ */
+TEST_F(BasicModel, Accessors_Cached_Snapshot) {
+  ASSERT_NE(model_, nullptr);
+
+  // Recruitment process
+  vector<string> recruitment_categories   = { "immature.male", "immature.female" };
+  vector<string> proportions  = { "0.6", "0.4" };
+  base::Object* process = model_->factory().CreateObject(PARAM_RECRUITMENT, PARAM_CONSTANT, PartitionType::kAge);
+  ASSERT_NE(process, nullptr);
+  process->parameters().Add(PARAM_LABEL, "recruitment", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_TYPE, "constant", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_CATEGORIES, recruitment_categories, __FILE__, __LINE__);
+  process->parameters().Add(PARAM_PROPORTIONS, proportions, __FILE__, __LINE__);
+  process->parameters().Add(PARAM_R0, "100000", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_AGE, "1", __FILE__, __LINE__);
+
+  // Report process
+  base::Object* report = model_->factory().CreateObject(PARAM_REPORT, PARAM_DERIVED_QUANTITY);
+  ASSERT_NE(report, nullptr);
+  report->parameters().Add(PARAM_LABEL, "DQ", __FILE__, __LINE__);
+  report->parameters().Add(PARAM_TYPE, "derived_quantity", __FILE__, __LINE__);
+
+  // Mortality process
+  vector<string> mortality_categories   = { "immature.male", "immature.female", "mature.male", "mature.female" };
+  process = model_->factory().CreateObject(PARAM_MORTALITY, PARAM_CONSTANT_RATE, PartitionType::kAge);
+  ASSERT_NE(process, nullptr);
+  process->parameters().Add(PARAM_LABEL, "mortality", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_TYPE, "constant_rate", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_CATEGORIES, mortality_categories, __FILE__, __LINE__);
+  process->parameters().Add(PARAM_M, "0.065", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_SELECTIVITIES, "constant_one", __FILE__, __LINE__);
+
+  // Ageing process
+  vector<string> ageing_categories   = { "immature.male", "immature.female" };
+  process = model_->factory().CreateObject(PARAM_AGEING, "");
+  ASSERT_NE(process, nullptr);
+  process->parameters().Add(PARAM_LABEL, "ageing", __FILE__, __LINE__);
+  process->parameters().Add(PARAM_CATEGORIES, ageing_categories, __FILE__, __LINE__);
+
+  // Timestep
+  base::Object* time_step = model_->factory().CreateObject(PARAM_TIME_STEP, "");
+  ASSERT_NE(time_step, nullptr);
+  vector<string> processes    = { "ageing", "recruitment", "mortality" };
+  time_step->parameters().Add(PARAM_LABEL, "step_one", __FILE__, __LINE__);
+  time_step->parameters().Add(PARAM_PROCESSES, processes, __FILE__, __LINE__);
+
+  // Run the model
+  model_->Start(RunMode::kTesting);
+  model_->FullIteration();
+
+  // Build our accessor
+  vector<string> accessor_category_labels = { "immature.male+immature.female", "immature.male", "immature.female" };
+  SnapshotPtr accessor = SnapshotPtr(new Snapshot(model_, accessor_category_labels));
+
+  ASSERT_EQ(3u, accessor->Size());
+  ASSERT_EQ(2u, accessor->category_count());
+  accessor->BuildCache();
+  ASSERT_EQ(3u, accessor->Size());
+
+  ASSERT_EQ(2u, accessor->category_count(0));
+  ASSERT_EQ(1u, accessor->category_count(1));
+  ASSERT_EQ(1u, accessor->category_count(2));
+
+  // Categories are only stored once
+  EXPECT_EQ(accessor->data(0, 0), accessor->data(1, 0));
+  EXPECT_EQ(accessor->data(0, 1), accessor->data(2, 0));
+  EXPECT_EQ(0u, accessor->category_index(0, 0));
+  EXPECT_EQ(1u, accessor->category_index(0, 1));
+  EXPECT_EQ(accessor->category_data(1), accessor->data(2, 0));
+
+  partition::Category& male = model_->partition().category("immature.male");
+  partition::Category& female = model_->partition().category("immature.female");
+  for (unsigned i = 0; i < male.data_.size(); ++i) {
+    EXPECT_DOUBLE_EQ(male.data_[i], accessor->data(1, 0)[i]);
+    EXPECT_DOUBLE_EQ(female.data_[i], accessor->data(2, 0)[i]);
+  }
+
+  // Values are a copy of the partition at the time BuildCache() was called
+  Double original_value = male.data_[0];
+  male.data_[0] += 1000.0;
+  EXPECT_DOUBLE_EQ(original_value, accessor->data(0, 0)[0]);
+  accessor->BuildCache();
+  EXPECT_DOUBLE_EQ(original_value + 1000.0, accessor->data(0, 0)[0]);
+}
+
+} /* namespace cached */
+} /* namespace accessors */
+} /* namespace partition */
+} /* namespace niwa */
+#endif
@@ -0,0 +1,96 @@
+/**
+ * @file Snapshot.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @version 1.0
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
+ */
+
+// headers
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <boost/algorithm/string/split.hpp>
+#include <boost/algorithm/string/classification.hpp>
+
+// namespaces
+namespace niwa {
+namespace partition {
+namespace accessors {
+namespace cached {
+
+/**
+ * Default constructor
+ *
+ * Resolve each of the category labels (which may be combined with a +) to
+ * a unique category index and allocate a single buffer large enough to
+ * hold the data for every unique category.
+ *
+ * @param model Pointer to our model
+ * @param category_labels The list of (possibly combined) category labels
+ */
+Snapshot::Snapshot(Model* model, const vector<string>& category_labels)
+  : model_(model) {
+  LOG_FINEST() << "Categories: " << category_labels.size();
+
+  Partition& partition = model_->partition();
+  vector<string> split_category_labels;
+  collection_rows_.resize(category_labels.size());
+  active_rows_.resize(category_labels.size());
+
+  unsigned buffer_size = 0;
+  for (unsigned i = 0; i < category_labels.size(); ++i) {
+    boost::split(split_category_labels, category_labels[i], boost::is_any_of("+"));
+
+    for (const string& label : split_category_labels) {
+      partition::Category* category = &partition.category(label);
+      auto iter = std::find(categories_.begin(), categories_.end(), category);
+      unsigned index = std::distance(categories_.begin(), iter);
+
+      if (iter == categories_.end()) {
+        categories_.push_back(category);
+        offsets_.push_back(buffer_size);
+        buffer_size += category->data_.size();
+      }
+      collection_rows_[i].push_back(index);
+    }
+
+    active_rows_[i].reserve(collection_rows_[i].size());
+  }
+
+  values_.resize(buffer_size, 0.0);
+}
+
+/**
+ * Take a copy of the current partition values for each
+ * of our categories. The rows that are active in the
+ * current year are also refreshed so they line up with
+ * accessors::CombinedCategories.
+ *
+ * No memory is allocated by this method.
+ */
+void Snapshot::BuildCache() {
+  for (unsigned i = 0; i < categories_.size(); ++i)
+    std::copy(categories_[i]->data_.begin(), categories_[i]->data_.end(), values_.begin() + offsets_[i]);
+
+  unsigned year = model_->current_year();
+  for (unsigned i = 0; i < collection_rows_.size(); ++i) {
+    active_rows_[i].clear();
+    for (unsigned index : collection_rows_[i]) {
+      const vector<unsigned>& years = categories_[index]->years_;
+      if (std::find(years.begin(), years.end(), year) == years.end())
+        continue; // Not valid in this year
+
+      active_rows_[i].push_back(index);
+    }
+  }
+}
+
+} /* namespace cached */
+} /* namespace accessors */
+} /* namespace partition */
+} /* namespace niwa */
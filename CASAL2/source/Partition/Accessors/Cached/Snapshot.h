@@ -0,0 +1,83 @@
+/**
+ * @file Snapshot.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @version 1.0
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * A snapshot is a light-weight alternative to cached::CombinedCategories.
+ * Instead of copying full partition::Category objects it only stores the
+ * data_ row (numbers at age or length) for each unique category in a
+ * single flat buffer that is allocated when the object is constructed.
+ *
+ * Categories are stored once by their index in the list of unique
+ * labels, so "male+female" and "male" will share the same row. Calls
+ * to BuildCache() only copy the values and never allocate.
+ *
+ * Usage mirrors accessors::CombinedCategories, the row returned by
+ * data(collection, index) matches the index'th category of the same
+ * collection in the non-cached accessor for the current year.
+ */
+#ifndef PARTITION_ACCESSORS_CACHED_SNAPSHOT_H_
+#define PARTITION_ACCESSORS_CACHED_SNAPSHOT_H_
+
+// Headers
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "Model/Model.h"
+#include "Partition/Partition.h"
+#include "Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace partition {
+namespace accessors {
+namespace cached {
+
+using std::vector;
+using std::string;
+using niwa::utilities::Double;
+
+/**
+ * Class definition
+ */
+class Snapshot {
+public:
+  // Methods
+  Snapshot() = delete;
+  Snapshot(Model* model, const vector<string>& category_labels);
+  virtual                     ~Snapshot() = default;
+  void                        BuildCache();
+  unsigned                    Size() const { return active_rows_.size(); }
+
+  // accessors
+  unsigned                    category_count() const { return categories_.size(); }
+  unsigned                    category_count(unsigned collection) const { return active_rows_[collection].size(); }
+  const Double*               data(unsigned collection, unsigned index) const { return &values_[offsets_[active_rows_[collection][index]]]; }
+  const Double*               category_data(unsigned category_index) const { return &values_[offsets_[category_index]]; }
+  unsigned                    category_index(unsigned collection, unsigned index) const { return active_rows_[collection][index]; }
+
+private:
+  // Members
+  Model*                      model_ = nullptr;
+  vector<partition::Category*> categories_;
+  vector<unsigned>            offsets_;
+  vector<Double>              values_;
+  vector<vector<unsigned>>    collection_rows_;
+  vector<vector<unsigned>>    active_rows_;
+};
+
+// Typedef
+typedef std::shared_ptr<niwa::partition::accessors::cached::Snapshot> SnapshotPtr;
+
+} /* namespace cached */
+} /* namespace accessors */
+} /* namespace partition */
+} /* namespace niwa */
+#endif /* PARTITION_ACCESSORS_CACHED_SNAPSHOT_H_ */
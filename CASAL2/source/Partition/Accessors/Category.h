@@ -23,6 +23,7 @@
 #include <string>
 
 #include "Model/Model.h"
+#include "Partition/CategoryData.h"
 #include "Utilities/Types.h"
 
 // Namespaces
@@ -42,7 +43,7 @@ using niwa::utilities::Double;
 class Category {
 public:
   // Typedefs
-  typedef vector<Double>* DataType;
+  typedef partition::CategoryData* DataType;
 
   // Methods
   Category() = delete;
@@ -108,13 +108,13 @@ void Category::UpdateMeanWeightData() {
  */
 void Category::CollapseAgeLengthData() {
   LOG_CODE_ERROR() << "This is hideously slow, do not allocate memory with the .push_back";
-  data_.clear();
+  data_.resize(age_length_matrix_.size());
 
-  for (auto age_row : age_length_matrix_) {
+  for (unsigned i = 0; i < age_length_matrix_.size(); ++i) {
     Double total = 0;
-    for (Double length_data : age_row)
+    for (Double length_data : age_length_matrix_[i])
       total += length_data;
-    data_.push_back(total);
+    data_[i] = total;
   }
 }
 
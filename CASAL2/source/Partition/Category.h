@@ -21,6 +21,7 @@
 #include <vector>
 #include <string>
 
+#include "Partition/CategoryData.h"
 #include "Utilities/Types.h"
 #include "Selectivities/Selectivity.h"
 
@@ -58,12 +59,12 @@ public:
   unsigned                    age_spread() const { return (max_age_ - min_age_) + 1; }
 
   // members
-  short                       id_ = 0;
+  unsigned                    id_ = 0;
   string                      name_ = "";
   unsigned                    min_age_ = 0;
   unsigned                    max_age_ = 0;
   vector<unsigned>            years_;
-  vector<Double>              data_;
+  CategoryData                data_; // bound to the contiguous partition storage
   vector<Double>              length_data_;
   vector<vector<Double>>      age_length_matrix_; // age_length_matrix_[age][length]
 
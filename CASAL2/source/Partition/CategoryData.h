@@ -0,0 +1,111 @@
+/**
+ * @file CategoryData.h
+ * @author Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @github https://github.com/Zaita
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This object holds the numbers at age (or length) for a single
+ * category. The partition binds each category to a row of one
+ * contiguous block of memory (see Partition::Build()) so processes
+ * that walk every category are reading memory linearly.
+ *
+ * The interface follows std::vector so existing code that indexes
+ * data_ or iterates over it does not need to change. A copy of a
+ * CategoryData object (e.g. in the cached accessors) owns its own
+ * memory so it is a true copy of the values at that point in time.
+ */
+#ifndef PARTITION_CATEGORYDATA_H_
+#define PARTITION_CATEGORYDATA_H_
+
+// headers
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+#include "Logging/Logging.h"
+#include "Utilities/Types.h"
+
+// namespaces
+namespace niwa {
+namespace partition {
+using std::vector;
+using niwa::utilities::Double;
+
+/**
+ * Class definition
+ */
+class CategoryData {
+public:
+  // typedefs
+  typedef Double*                                 iterator;
+  typedef const Double*                           const_iterator;
+  typedef std::reverse_iterator<iterator>         reverse_iterator;
+  typedef std::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+  // methods
+  CategoryData() = default;
+  CategoryData(const CategoryData& rhs) : owned_(rhs.begin(), rhs.end()) { values_ = owned_.data(); size_ = owned_.size(); }
+  ~CategoryData() = default;
+  CategoryData&               operator=(const CategoryData& rhs) { assign(rhs.begin(), rhs.end()); return *this; }
+  CategoryData&               operator=(const vector<Double>& rhs) { assign(rhs.begin(), rhs.end()); return *this; }
+  void                        Bind(Double* values, unsigned size) { owned_.clear(); values_ = values; size_ = size; bound_ = true; }
+  bool                        is_bound() const { return bound_; }
+
+  /**
+   * Change the size of an unbound (owning) object.
+   * Rows bound to the partition cannot be resized.
+   */
+  void resize(unsigned size, Double value = 0.0) {
+    if (bound_ && size != size_)
+      LOG_CODE_ERROR() << "Cannot resize category data bound to the partition from " << size_ << " to " << size;
+    if (!bound_) {
+      owned_.resize(size, value);
+      values_ = owned_.data();
+      size_ = size;
+    }
+  }
+
+  void assign(unsigned size, Double value) {
+    resize(size, value);
+    std::fill(begin(), end(), value);
+  }
+
+  template<typename Iterator>
+  void assign(Iterator first, Iterator last) {
+    resize(std::distance(first, last));
+    std::copy(first, last, begin());
+  }
+
+  // accessors
+  unsigned                    size() const { return size_; }
+  bool                        empty() const { return size_ == 0; }
+  Double*                     data() { return values_; }
+  const Double*               data() const { return values_; }
+  Double&                     operator[](unsigned index) { return values_[index]; }
+  const Double&               operator[](unsigned index) const { return values_[index]; }
+  iterator                    begin() { return values_; }
+  iterator                    end() { return values_ + size_; }
+  const_iterator              begin() const { return values_; }
+  const_iterator              end() const { return values_ + size_; }
+  reverse_iterator            rbegin() { return reverse_iterator(end()); }
+  reverse_iterator            rend() { return reverse_iterator(begin()); }
+  const_reverse_iterator      rbegin() const { return const_reverse_iterator(end()); }
+  const_reverse_iterator      rend() const { return const_reverse_iterator(begin()); }
+
+private:
+  // members
+  Double*                     values_ = nullptr;
+  unsigned                    size_ = 0;
+  vector<Double>              owned_;
+  bool                        bound_ = false;
+};
+
+} /* namespace partition */
+} /* namespace niwa */
+
+#endif /* PARTITION_CATEGORYDATA_H_ */
@@ -15,6 +15,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 #include <boost/lexical_cast.hpp>
+#include <cstdint>
 
 #include "AgeLengths/Age/VonBertalanffy.h"
 #include "Categories/Categories.h"
@@ -136,6 +137,53 @@ TEST(Partition, ValidateAndBuild) {
   EXPECT_EQ(nullptr, category.age_length_);
 }
 
+/**
+ * This method will test that the category data is stored in a single
+ * contiguous block and each category can be found by its id
+ */
+TEST(Partition, ContiguousStorage) {
+  MockModel model;
+  MockCategories mock_categories(&model);
+  MockPartition partition(&model);
+
+  model.bind_calls();
+  EXPECT_CALL(model, categories()).WillRepeatedly(Return(&mock_categories));
+
+  ASSERT_NO_THROW(mock_categories.Validate());
+  ASSERT_NO_THROW(partition.Validate());
+  ASSERT_NO_THROW(partition.Build());
+
+  ASSERT_EQ(4u, partition.category_count());
+  ASSERT_EQ(0u, partition.row_stride() % (64 / sizeof(Double)));
+
+  vector<string> names = mock_categories.category_names();
+  for (unsigned i = 0; i < names.size(); ++i) {
+    EXPECT_EQ(i, partition.category_id(names[i]));
+    EXPECT_EQ(&partition.category(names[i]), &partition.category(i));
+    EXPECT_TRUE(partition.category(i).data_.is_bound());
+    EXPECT_EQ(10u, partition.category(i).data_.size());
+    EXPECT_EQ(0u, reinterpret_cast<std::uintptr_t>(partition.category(i).data_.data()) % 64);
+    if (i > 0) {
+      EXPECT_EQ(partition.category(i - 1).data_.data() + partition.row_stride(), partition.category(i).data_.data());
+    }
+  }
+
+  // a copy of the category data is not bound to the partition
+  partition.category(1).data_[3] = 5.0;
+  partition::CategoryData copy = partition.category(1).data_;
+  EXPECT_FALSE(copy.is_bound());
+  EXPECT_DOUBLE_EQ(5.0, copy[3]);
+
+  partition.Reset();
+  EXPECT_DOUBLE_EQ(0.0, partition.category(1).data_[3]);
+  EXPECT_DOUBLE_EQ(5.0, copy[3]);
+
+  // assigning the copy back puts the values in the partition storage
+  partition.category(1).data_ = copy;
+  EXPECT_DOUBLE_EQ(5.0, partition.category(1).data_[3]);
+  EXPECT_TRUE(partition.category(1).data_.is_bound());
+}
+
 /**
  * This method will test the X method
  */
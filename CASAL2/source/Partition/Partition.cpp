@@ -16,10 +16,13 @@
 // Headers
 #include "Partition.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstdint>
 
 #include "AgeLengths/AgeLength.h"
 #include "Categories/Categories.h"
+#include "Model/Checkpoint.h"
 #include "Model/Model.h"
 #include "Logging/Logging.h"
 
@@ -49,6 +52,11 @@ void Partition::Validate() {
  * We're not interested in the range of years that each
  * category has because this will be addressed with the
  * accessor objects.
+ *
+ * The numbers at age (or length) for every category are stored
+ * in a single block of memory with one row per category. Each row
+ * starts on a cache line so processes iterating over the categories
+ * in id order stream through memory.
  */
 void Partition::Build() {
   Categories* categories                    = model_->categories();
@@ -58,6 +66,7 @@ void Partition::Build() {
     LOG_FINEST() << "Adding category " << category << " to the partition";
 
     partition::Category* new_category = new partition::Category(model_);
+    new_category->id_         = categories_.size();
     new_category->name_       = category;
     new_category->min_age_    = categories->min_age(category);
     new_category->max_age_    = categories->max_age(category);
@@ -83,7 +92,23 @@ void Partition::Build() {
       new_category->data_.resize(length_bins, 0.0);
     }
     partition_[category] = new_category;
+    categories_.push_back(new_category);
   }
+
+  // Lay out the contiguous storage and bind each category to its row
+  const unsigned cache_line_length = sizeof(Double) < 64 ? 64 / sizeof(Double) : 1;
+  row_stride_ = 0;
+  for (auto category : categories_)
+    row_stride_ = category->data_.size() > row_stride_ ? category->data_.size() : row_stride_;
+  row_stride_ = ((row_stride_ + cache_line_length - 1) / cache_line_length) * cache_line_length;
+
+  storage_.assign(categories_.size() * row_stride_ + cache_line_length, 0.0);
+  unsigned misalignment = (reinterpret_cast<std::uintptr_t>(storage_.data()) % 64) / sizeof(Double);
+  data_ = storage_.data() + (misalignment == 0 || cache_line_length == 1 ? 0 : cache_line_length - misalignment);
+  LOG_FINEST() << "Partition storage has " << categories_.size() << " rows with a stride of " << row_stride_;
+
+  for (auto category : categories_)
+    category->data_.Bind(data_ + category->id_ * row_stride_, category->data_.size());
 }
 
 /**
@@ -283,9 +308,29 @@ void Partition::BuildAgeLengthProportions() {
  * Reset our partition so all data values are 0.0
  */
 void Partition::Reset() {
-  for (auto iter = partition_.begin(); iter != partition_.end(); ++iter) {
-    iter->second->data_.assign(iter->second->data_.size(), 0.0);
-  }
+  std::fill(storage_.begin(), storage_.end(), 0.0);
+}
+
+/**
+ * Save the numbers at age (or length) for every category
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void Partition::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("partition", storage_);
+}
+
+/**
+ * Restore the numbers at age (or length) for every category. The values
+ * are copied in to the existing block so the categories stay bound to it.
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void Partition::RestoreState(const Checkpoint& checkpoint) {
+  const vector<Double>& values = checkpoint.values("partition");
+  if (values.size() != storage_.size())
+    LOG_CODE_ERROR() << "The checkpoint partition has " << values.size() << " values but the partition has " << storage_.size();
+  std::copy(values.begin(), values.end(), storage_.begin());
 }
 
 /**
@@ -302,6 +347,17 @@ partition::Category& Partition::category(const string& category_label) {
   return (*find_iter->second);
 }
 
+/**
+ * This method will return the id of one of our partition categories. The id
+ * can be used to access the category without a string lookup.
+ *
+ * @param category_label The name of the category
+ * @return id of the category
+ */
+unsigned Partition::category_id(const string& category_label) {
+  return category(category_label).id_;
+}
+
 /**
  *
  */
@@ -29,6 +29,7 @@
 // Namespaces
 namespace niwa {
 class Model;
+class Checkpoint;
 
 using std::string;
 using std::map;
@@ -46,11 +47,17 @@ public:
   void                        Build();
   void                        Reset();
   void                        Clear() { partition_.clear(); }
+  void                        SaveState(Checkpoint& checkpoint) const;
+  void                        RestoreState(const Checkpoint& checkpoint);
   void                        BuildMeanLengthData();
   void                        BuildAgeLengthProportions();
 
   // Accessors
   partition::Category&        category(const string& category_label);
+  partition::Category&        category(unsigned category_id) { return *categories_[category_id]; }
+  unsigned                    category_id(const string& category_label);
+  unsigned                    category_count() const { return categories_.size(); }
+  unsigned                    row_stride() const { return row_stride_; }
   utilities::Vector4&         age_length_proportions(const string& category_label);
 
 protected:
@@ -61,6 +68,10 @@ protected:
   // Members
   Model*                            model_ = nullptr;
   map<string, partition::Category*> partition_; // map<category label, partition::Category Struct>
+  vector<partition::Category*>      categories_; // indexed by partition::Category::id_
+  vector<Double>                    storage_; // categories_.size() x row_stride_, see Build()
+  Double*                           data_ = nullptr; // first cache aligned element of storage_
+  unsigned                          row_stride_ = 0;
   map<string, utilities::Vector4*>  age_length_proportions_; // map<category, vector<year, time_step, age, length, proportion>>;
 };
 
@@ -67,5 +67,39 @@ void Manager::FlagPenalty(const string& label, Double value) {
   flagged_penalties_.push_back(penalty);
 }
 
+/**
+ * Save the penalties that have been flagged so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void Manager::SaveState(Checkpoint& checkpoint) const {
+  vector<string> labels;
+  vector<Double> scores;
+  for (const Info& info : flagged_penalties_) {
+    labels.push_back(info.label_);
+    scores.push_back(info.score_);
+  }
+  checkpoint.Save("penalties.flagged", labels);
+  checkpoint.Save("penalties.flagged", scores);
+}
+
+/**
+ * Restore the flagged penalties saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void Manager::RestoreState(const Checkpoint& checkpoint) {
+  vector<string> labels;
+  vector<Double> scores;
+  checkpoint.Restore("penalties.flagged", labels);
+  checkpoint.Restore("penalties.flagged", scores);
+
+  flagged_penalties_.resize(labels.size());
+  for (unsigned i = 0; i < labels.size(); ++i) {
+    flagged_penalties_[i].label_ = labels[i];
+    flagged_penalties_[i].score_ = scores[i];
+  }
+}
+
 } /* namespace penalties */
 } /* namespace niwa */
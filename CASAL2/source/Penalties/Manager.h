@@ -18,6 +18,7 @@
 
 // Headers
 #include "BaseClasses/Manager.h"
+#include "Model/Checkpoint.h"
 #include "Penalties/Common/Process.h"
 #include "Penalties/Penalty.h"
 #include "Utilities/Types.h"
@@ -49,6 +50,8 @@ public:
   penalties::Process*         GetProcessPenalty(const string& label);
   void                        FlagPenalty(const string& label, Double value);
   void                        Reset() override final { flagged_penalties_.clear(); }
+  void                        SaveState(Checkpoint& checkpoint) const;
+  void                        RestoreState(const Checkpoint& checkpoint);
 
   // Accessors
   const vector<Info>&         flagged_penalties() const { return flagged_penalties_; }
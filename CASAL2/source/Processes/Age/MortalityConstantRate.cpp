@@ -219,6 +219,24 @@ void MortalityConstantRate::FillTabularReportCache(ostringstream& cache, bool fi
 
 }
 
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void MortalityConstantRate::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].total_removals_by_year", total_removals_by_year_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void MortalityConstantRate::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].total_removals_by_year", total_removals_by_year_);
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
@@ -224,6 +224,26 @@ void MortalityEvent::FillTabularReportCache(ostringstream& cache, bool first_run
 
 }
 
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void MortalityEvent::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].actual_catches", actual_catches_);
+  checkpoint.Save("process[" + label_ + "].exploitation", exploitation_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void MortalityEvent::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].actual_catches", actual_catches_);
+  checkpoint.Restore("process[" + label_ + "].exploitation", exploitation_);
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
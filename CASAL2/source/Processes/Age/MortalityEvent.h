@@ -46,6 +46,8 @@ public:
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
+  void                        SaveState(Checkpoint& checkpoint) const override final;
+  void                        RestoreState(const Checkpoint& checkpoint) override final;
 private:
   // Members
   vector<string>              category_labels_;
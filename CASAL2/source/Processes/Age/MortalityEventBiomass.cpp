@@ -219,7 +219,25 @@ void MortalityEventBiomass::FillTabularReportCache(ostringstream& cache, bool fi
 
 }
 
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void MortalityEventBiomass::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].actual_catches", actual_catches_);
+  checkpoint.Save("process[" + label_ + "].exploitation_by_year", exploitation_by_year_);
+}
 
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void MortalityEventBiomass::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].actual_catches", actual_catches_);
+  checkpoint.Restore("process[" + label_ + "].exploitation_by_year", exploitation_by_year_);
+}
 
 } /* namespace age */
 } /* namespace processes */
@@ -41,6 +41,8 @@ public:
   void                        DoExecute() override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
+  void                        SaveState(Checkpoint& checkpoint) const override final;
+  void                        RestoreState(const Checkpoint& checkpoint) override final;
 private:
   // members
   accessor::Categories        partition_;
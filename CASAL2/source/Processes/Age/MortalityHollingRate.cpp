@@ -426,6 +426,29 @@ void MortalityHollingRate::FillTabularReportCache(ostringstream& cache, bool fir
       cache <<  actual_catches.second << " ";
   }*/
 }
+
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void MortalityHollingRate::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].prey_vulnerability_by_year", prey_vulnerability_by_year_);
+  checkpoint.Save("process[" + label_ + "].prey_mortality_by_year", prey_mortality_by_year_);
+  checkpoint.Save("process[" + label_ + "].predator_vulnerability_by_year", predator_vulnerability_by_year_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void MortalityHollingRate::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].prey_vulnerability_by_year", prey_vulnerability_by_year_);
+  checkpoint.Restore("process[" + label_ + "].prey_mortality_by_year", prey_mortality_by_year_);
+  checkpoint.Restore("process[" + label_ + "].predator_vulnerability_by_year", predator_vulnerability_by_year_);
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
@@ -13,6 +13,9 @@
 // Headers
 #include "MortalityInstantaneous.h"
 
+#include <chrono>
+#include <iostream>
+
 #include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Processes/Manager.h"
 #include "Model/Model.h"
@@ -194,6 +197,64 @@ FishingEest  stock   eastFSel 0.7 step1 none
 end_table
 )";
 
+const std::string test_cases_process_mortality_instantaneous_multiple_fisheries =
+R"(
+@process fishing
+type mortality_instantaneous
+m 0.0798
+selectivities One
+categories stock
+table catches
+year FishingWest FishingEast FishingChat FishingLine
+1975 381000 204000 222000 1433000
+1976 99000 124000 294000 292000
+1977 424000 646000 49000 1139000
+1978 269000 88000 64000 988000
+1979 478000 121000 143000 285000
+1980 614000 484000 50000 1258000
+1981 176000 278000 51000 1281000
+1982 649000 456000 45000 552000
+1983 97000 620000 88000 693000
+1984 479000 197000 296000 341000
+1985 634000 365000 112000 311000
+1986 645000 634000 116000 862000
+1987 149000 610000 52000 1255000
+1988 111000 683000 125000 1116000
+1989 746000 594000 238000 743000
+1990 526000 649000 252000 840000
+1991 356000 304000 112000 599000
+1992 133000 638000 173000 1175000
+1993 556000 401000 249000 689000
+1994 673000 124000 80000 1148000
+1995 478000 218000 195000 411000
+1996 550000 481000 40000 1468000
+1997 129000 832000 180000 796000
+1998 761000 408000 274000 1287000
+1999 866000 517000 55000 291000
+2000 326000 535000 53000 224000
+2001 798000 768000 178000 1425000
+2002 641000 747000 248000 682000
+2003 783000 445000 197000 146000
+2004 522000 413000 106000 1351000
+2005 169000 555000 50000 546000
+2006 836000 344000 86000 607000
+2007 457000 450000 274000 265000
+2008 220000 509000 225000 1225000
+2009 334000 190000 240000 1226000
+2010 335000 773000 232000 834000
+2011 749000 439000 138000 409000
+2012 134000 230000 97000 575000
+end_table
+
+table method
+method  category selectivity u_max time_step penalty
+FishingWest  stock  westFSel    0.7  step1 none
+FishingEast  stock  eastFSel    0.7  step1 none
+FishingChat  stock  chatTANSel  0.01 step1 none
+FishingLine  stock  MaturationSel 0.7 step1 none
+end_table
+)";
+
 /**
  *
  */
@@ -217,6 +278,65 @@ TEST_F(InternalEmptyModel, Processes_Mortality_Instantaneous_Simple) {
   }
 }
 
+/**
+ * Run a model with several fisheries fishing the same category, one of
+ * which has its exploitation rescaled to u_max every year
+ */
+TEST_F(InternalEmptyModel, Processes_Mortality_Instantaneous_Multiple_Fisheries) {
+  AddConfigurationLine(test_cases_process_mortality_instantaneous, __FILE__, 31);
+  AddConfigurationLine(test_cases_process_mortality_instantaneous_multiple_fisheries, __FILE__, 200);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  vector<Double> expected = { 0.000000, 4962889.1820437862, 4081806.0044308235, 3343404.5941329189, 2725317.3144256612,
+      2206991.4099270627, 1775590.3901336184, 1422933.4938181543, 1136610.7654707467, 905226.26430036011,
+      718917.96640136582, 571781.40114513179, 455206.90512026096, 361942.69108668627, 287752.86569848203,
+      229274.16338538696, 183064.07268148885, 146684.89191920226, 117898.2621665761, 95093.530962542791,
+      76776.697887120521, 62061.092943592419, 50222.66192637635, 40666.43394702825, 32920.223213045771,
+      26678.07466640597, 21638.664739100142, 17528.474135793858, 14215.706769395261, 63351.222833362583 };
+
+  partition::Category& stock = model_->partition().category("stock");
+  for (unsigned i = 0; i < expected.size(); ++i) {
+    EXPECT_DOUBLE_EQ(expected[i], stock.data_[i]) << " with i = " << i;
+  }
+
+  MortalityInstantaneous* process = dynamic_cast<MortalityInstantaneous*>(model_->managers().process()->GetProcess("fishing"));
+  ASSERT_NE(nullptr, process);
+  vector<Double> expected_removals = { 0.0, 1337.4392862386355, 2744.7288494551344, 5835.2181167921335, 10582.485208979606 };
+  vector<Double>& removals = process->removals(2012, "FishingLine", "stock");
+  ASSERT_EQ(30u, removals.size());
+  for (unsigned i = 0; i < expected_removals.size(); ++i)
+    EXPECT_DOUBLE_EQ(expected_removals[i], removals[i]) << " with i = " << i;
+  EXPECT_EQ(0u, process->removals(2012, "FishingSouth", "stock").size());
+  EXPECT_EQ(0u, process->removals(1960, "FishingLine", "stock").size());
+}
+
+/**
+ * Micro-benchmark of the multiple fishery model. Reports the average
+ * time taken for a full iteration of the model.
+ */
+TEST_F(InternalEmptyModel, Processes_Mortality_Instantaneous_Multiple_Fisheries_Benchmark) {
+  AddConfigurationLine(test_cases_process_mortality_instantaneous, __FILE__, 31);
+  AddConfigurationLine(test_cases_process_mortality_instantaneous_multiple_fisheries, __FILE__, 200);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+  partition::Category& stock = model_->partition().category("stock");
+  vector<Double> expected(stock.data_.begin(), stock.data_.end());
+
+  const unsigned iterations = 20;
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < iterations; ++i)
+    model_->FullIteration();
+  auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  std::cout << "[ BENCHMARK] mortality_instantaneous multiple fisheries: " << elapsed / iterations << " us per iteration" << std::endl;
+  RecordProperty("microseconds_per_iteration", (int)(elapsed / iterations));
+  for (unsigned i = 0; i < expected.size(); ++i)
+    EXPECT_DOUBLE_EQ(AS_DOUBLE(expected[i]), AS_DOUBLE(stock.data_[i])) << " with i = " << i;
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
@@ -409,6 +409,29 @@ void MortalityInstantaneous::DoBuild() {
     }
   }
 
+  /**
+   * Resolve the fishery x category combinations executed in each time step
+   * to indexes so DoExecute() does not need to compare labels
+   */
+  fishery_categories_by_time_step_.assign(time_steps.size(), vector<unsigned>());
+  fisheries_by_time_step_.assign(time_steps.size(), vector<FisheryData*>());
+  categories_used_by_time_step_.assign(time_steps.size(), vector<bool>(categories_.size(), false));
+  fishery_category_index_.clear();
+  for (auto& fishery_iter : fisheries_) {
+    fishery_iter.second.categories_.clear();
+    fisheries_by_time_step_[fishery_iter.second.time_step_index_].push_back(&fishery_iter.second);
+  }
+
+  for (unsigned i = 0; i < fishery_categories_.size(); ++i) {
+    auto& fishery_category = fishery_categories_[i];
+    unsigned time_step_index = fishery_category.fishery_.time_step_index_;
+    fishery_categories_by_time_step_[time_step_index].push_back(i);
+    categories_used_by_time_step_[time_step_index][&fishery_category.category_ - categories_.data()] = true;
+    fishery_category.fishery_.categories_.push_back(&fishery_category.category_);
+    fishery_category_index_[fishery_category.fishery_label_][fishery_category.category_label_] = i;
+  }
+  mean_weights_.assign(model_->age_spread(), 0.0);
+
   // reserve memory for reporting objects
   removals_by_category_age_.resize(category_labels_.size());
   for (unsigned i = 0; i < category_labels_.size(); ++i)
@@ -446,6 +469,10 @@ void MortalityInstantaneous::RebuildCache() {
 
 /**
  * Execute this process
+ *
+ * The selectivities and exp(-0.5 * M) terms are calculated once for each
+ * category and fishery category, then reused by the vulnerability,
+ * exploitation and removals loops.
  */
 
 void MortalityInstantaneous::DoExecute() {
@@ -454,33 +481,37 @@ void MortalityInstantaneous::DoExecute() {
   unsigned time_step_index = model_->managers().time_step()->current_time_step();
   unsigned year =  model_->current_year();
   Double ratio = time_step_ratios_[time_step_index];
-  Double selectivity_value = 0.0;
+  const vector<unsigned>& time_step_fishery_categories = fishery_categories_by_time_step_[time_step_index];
+  const vector<bool>& time_step_categories_used = categories_used_by_time_step_[time_step_index];
 
-  for (auto& category : categories_) {
-    // Is this category used?
-    bool used = false;
-    for (auto& fishery_category : fishery_categories_) {
-      if (fishery_category.category_label_ == category.category_label_ && fishery_category.fishery_.time_step_index_ == time_step_index)
-        used = true;
-
-      category.used_in_current_timestep_ = used;
-
-      for (unsigned i = 0; i < category.category_->age_spread(); ++i) {
-        selectivity_value = category.selectivity_->GetAgeResult(category.category_->min_age_ + i, category.category_->age_length_);
-        category.exploitation_[i] = 0.0;
-        category.selectivity_values_[i] = selectivity_value;
-        if (used)
-          category.exp_values_[i] = exp(-0.5 * ratio * (*category.m_) * selectivity_value);
-      }
+  /**
+   * Calculate the natural mortality selectivity for each category once and
+   * the exp(-0.5 * M) term for the categories that are fished in this time step
+   */
+  for (unsigned category_index = 0; category_index < categories_.size(); ++category_index) {
+    auto& category = categories_[category_index];
+    unsigned age_spread = category.category_->age_spread();
+    unsigned min_age = category.category_->min_age_;
+    Double* selectivity_values = category.selectivity_values_.data();
+    Double* exp_values = category.exp_values_.data();
+
+    category.used_in_current_timestep_ = time_step_categories_used[category_index];
+    for (unsigned i = 0; i < age_spread; ++i)
+      selectivity_values[i] = category.selectivity_->GetAgeResult(min_age + i, category.category_->age_length_);
+    std::fill(category.exploitation_.begin(), category.exploitation_.end(), 0.0);
+
+    if (category.used_in_current_timestep_) {
+      Double half_m = -0.5 * ratio * (*category.m_);
+      for (unsigned i = 0; i < age_spread; ++i)
+        exp_values[i] = exp(half_m * selectivity_values[i]);
     }
   }
 
-  for (auto& fishery_category : fishery_categories_) {
-    if (fishery_category.fishery_.time_step_index_ != time_step_index)
-      continue;
-
+  for (unsigned fishery_category_index : time_step_fishery_categories) {
+    auto& fishery_category = fishery_categories_[fishery_category_index];
+    unsigned min_age = fishery_category.category_.category_->min_age_;
     for (unsigned i = 0; i < fishery_category.selectivity_values_.size(); ++i)
-      fishery_category.selectivity_values_[i] = fishery_category.selectivity_->GetAgeResult(fishery_category.category_.category_->min_age_ + i, fishery_category.category_.category_->age_length_);
+      fishery_category.selectivity_values_[i] = fishery_category.selectivity_->GetAgeResult(min_age + i, fishery_category.category_.category_->age_length_);
   }
 
   for (auto& fishery : fisheries_)
@@ -492,35 +523,34 @@ void MortalityInstantaneous::DoExecute() {
    */
   if (model_->state() != State::kInitialise || (find(time_steps_to_skip_applying_F_mortaltiy_.begin(),time_steps_to_skip_applying_F_mortaltiy_.end(), time_step_index) != time_steps_to_skip_applying_F_mortaltiy_.end())) {
     LOG_FINEST() << "time step = " << time_step_index << " not in initialisation and there is an F method in this timestep.";
-      for (auto& fishery_category : fishery_categories_) {
-        LOG_FINEST() << "checking fishery = " << fishery_category.fishery_label_;
-        if (fishery_category.fishery_.time_step_index_ != time_step_index)
-          continue;
-
-        partition::Category* category = fishery_category.category_.category_;
-        if (fishery_category.category_.age_weight_) {
-          for (unsigned i = 0; i < category->data_.size(); ++i) {
-            Double vulnerable = category->data_[i]
-                * fishery_category.category_.age_weight_->mean_weight_at_age_by_year(year, i + model_->min_age())
-                * fishery_category.selectivity_values_[i]
-                * fishery_category.category_.exp_values_[i];
-
-            fishery_category.fishery_.vulnerability_ += vulnerable;
-          }
-        } else {
-          for (unsigned i = 0; i < category->data_.size(); ++i) {
-            Double vulnerable = category->data_[i]
-                * category->mean_weight_by_time_step_age_[time_step_index][category->min_age_ + i]
-                * fishery_category.selectivity_values_[i]
-                * fishery_category.category_.exp_values_[i];
-
-            fishery_category.fishery_.vulnerability_ += vulnerable;
-          }
-        }
-        LOG_FINEST() << "Category is fished in this time_step " << time_step_index << " numbers at age = " << category->data_.size();
-        LOG_FINEST() << "Vulnerable biomass from category " << category->name_ << " contributing to fishery " << fishery_category.fishery_label_ << " = " << fishery_category.fishery_.vulnerability_;
+    Double* mean_weights = mean_weights_.data();
+    for (unsigned fishery_category_index : time_step_fishery_categories) {
+      auto& fishery_category = fishery_categories_[fishery_category_index];
+      LOG_FINEST() << "checking fishery = " << fishery_category.fishery_label_;
+
+      partition::Category* category = fishery_category.category_.category_;
+      unsigned age_spread = category->data_.size();
+      if (fishery_category.category_.age_weight_) {
+        for (unsigned i = 0; i < age_spread; ++i)
+          mean_weights[i] = fishery_category.category_.age_weight_->mean_weight_at_age_by_year(year, i + model_->min_age());
+      } else {
+        map<unsigned, Double>& mean_weight_by_age = category->mean_weight_by_time_step_age_[time_step_index];
+        for (unsigned i = 0; i < age_spread; ++i)
+          mean_weights[i] = mean_weight_by_age[category->min_age_ + i];
       }
 
+      const Double* numbers = category->data_.data();
+      const Double* selectivity_values = fishery_category.selectivity_values_.data();
+      const Double* exp_values = fishery_category.category_.exp_values_.data();
+      Double vulnerability = fishery_category.fishery_.vulnerability_;
+      for (unsigned i = 0; i < age_spread; ++i)
+        vulnerability += numbers[i] * mean_weights[i] * selectivity_values[i] * exp_values[i];
+      fishery_category.fishery_.vulnerability_ = vulnerability;
+
+      LOG_FINEST() << "Category is fished in this time_step " << time_step_index << " numbers at age = " << category->data_.size();
+      LOG_FINEST() << "Vulnerable biomass from category " << category->name_ << " contributing to fishery " << fishery_category.fishery_label_ << " = " << fishery_category.fishery_.vulnerability_;
+    }
+
     /**
      * Work out the exploitation rate to remove (catch/vulnerable) for each fishery
      */
@@ -536,14 +566,14 @@ void MortalityInstantaneous::DoExecute() {
       fishery.exploitation_ = exploitation;
     }
 
-    for (auto& fishery_category : fishery_categories_) {
-      if (fishery_category.fishery_.time_step_index_ != time_step_index)
-        continue;
-
-      partition::Category* category = fishery_category.category_.category_;
-      for (unsigned i = 0; i < category->data_.size(); ++i) {
-        fishery_category.category_.exploitation_[i] += fishery_category.fishery_.exploitation_ * fishery_category.selectivity_values_[i];
-      }
+    for (unsigned fishery_category_index : time_step_fishery_categories) {
+      auto& fishery_category = fishery_categories_[fishery_category_index];
+      unsigned age_spread = fishery_category.category_.category_->data_.size();
+      Double fishery_exploitation = fishery_category.fishery_.exploitation_;
+      const Double* selectivity_values = fishery_category.selectivity_values_.data();
+      Double* exploitation = fishery_category.category_.exploitation_.data();
+      for (unsigned i = 0; i < age_spread; ++i)
+        exploitation[i] += fishery_exploitation * selectivity_values[i];
     }
 
   /*
@@ -552,22 +582,14 @@ void MortalityInstantaneous::DoExecute() {
   */
     bool recalculate_age_exploitation = false;
     LOG_FINEST() << "Size of fishery_categories_ " << fishery_categories_.size();
-    vector<string> fisheries_checked;
 
-    for (auto& fishery_iter : fisheries_) {
-      auto& fishery = fishery_iter.second;
-      // Don't enter if this fishery is not executed here.
-      if (fishery.time_step_index_ != time_step_index)
-        continue;
-      auto& uobs = fishery.uobs_fishery_;
-      uobs = 0.0;
-      for (auto& fishery_category : fishery_categories_) {
-        if (fishery_category.fishery_.label_ != fishery.label_)
-          continue;
-        for (Double age_exploitation : fishery_category.category_.exploitation_) {
+    for (FisheryData* fishery : fisheries_by_time_step_[time_step_index]) {
+      Double uobs = 0.0;
+      for (CategoryData* category : fishery->categories_) {
+        for (Double age_exploitation : category->exploitation_)
           uobs = uobs > age_exploitation ? uobs : age_exploitation;
-        }
       }
+      fishery->uobs_fishery_ = uobs;
     }
 
     for (auto& fishery_iter : fisheries_) {
@@ -596,44 +618,46 @@ void MortalityInstantaneous::DoExecute() {
      */
     if (recalculate_age_exploitation) {
       for (auto& category : categories_) {
-        if (!category.used_in_current_timestep_)
-          continue;
-
-        for (unsigned i = 0; i < category.category_->age_spread(); ++i)
-          category.exploitation_[i] = 0.0;
+        if (category.used_in_current_timestep_)
+          std::fill(category.exploitation_.begin(), category.exploitation_.end(), 0.0);
       }
 
-      for (auto& fishery_category : fishery_categories_) {
-        partition::Category* category = fishery_category.category_.category_;
-        for (unsigned i = 0; i < category->data_.size(); ++i) {
-          fishery_category.category_.exploitation_[i] += fishery_category.fishery_.exploitation_ * fishery_category.selectivity_values_[i];
-        }
+      for (unsigned fishery_category_index : time_step_fishery_categories) {
+        auto& fishery_category = fishery_categories_[fishery_category_index];
+        unsigned age_spread = fishery_category.category_.category_->data_.size();
+        Double fishery_exploitation = fishery_category.fishery_.exploitation_;
+        const Double* selectivity_values = fishery_category.selectivity_values_.data();
+        Double* exploitation = fishery_category.category_.exploitation_.data();
+        for (unsigned i = 0; i < age_spread; ++i)
+          exploitation[i] += fishery_exploitation * selectivity_values[i];
       }
     }
+
     /**
      * Calculate the expectation for a proportions_at_age observation
-     *
      */
-    unsigned age_spread = model_->age_spread();
-    unsigned category_offset = 0;
-    for (auto& categories : partition_) {
-      for (auto& fishery_category : fishery_categories_) {
-        if (fishery_category.category_label_ == categories->name_
-            && fisheries_[fishery_category.fishery_label_].time_step_index_ == time_step_index) {
-          removals_by_year_fishery_category_[year][fishery_category.fishery_label_][categories->name_].assign(age_spread, 0.0);
-          for (unsigned i = 0; i < age_spread; ++i) {
-            unsigned age_offset = categories->min_age_ - model_->min_age();
-            if (i < age_offset)
-              continue;
-            removals_by_year_fishery_category_[year][fishery_category.fishery_label_][categories->name_][i] += categories->data_[i - age_offset]
-//                * fishery_exploitation[fishery_category.fishery_label_]
-                * fishery_category.fishery_.exploitation_
-                * fishery_category.selectivity_->GetAgeResult(categories->min_age_ + i, categories->age_length_)
-                * exp(-0.5 * ratio * m_[categories->name_] * selectivities_[category_offset]->GetAgeResult(categories->min_age_ + i, categories->age_length_));
-          }
-        }
-      }
-      category_offset++;
+    unsigned year_index = year - model_->start_year();
+    if (removals_by_year_fishery_category_.size() <= year_index)
+      removals_by_year_fishery_category_.resize(year_index + 1, vector<vector<Double>>(fishery_categories_.size()));
+    vector<vector<Double>>& removals_by_fishery_category = removals_by_year_fishery_category_[year_index];
+
+    for (unsigned fishery_category_index : time_step_fishery_categories) {
+      auto& fishery_category = fishery_categories_[fishery_category_index];
+      partition::Category* category = fishery_category.category_.category_;
+      if (std::find(category->years_.begin(), category->years_.end(), year) == category->years_.end())
+        continue; // Not valid in this year
+
+      unsigned age_spread = category->data_.size();
+      vector<Double>& removals = removals_by_fishery_category[fishery_category_index];
+      removals.resize(age_spread);
+
+      const Double* numbers = category->data_.data();
+      Double exploitation = fishery_category.fishery_.exploitation_;
+      const Double* selectivity_values = fishery_category.selectivity_values_.data();
+      const Double* exp_values = fishery_category.category_.exp_values_.data();
+      Double* removals_at_age = removals.data();
+      for (unsigned i = 0; i < age_spread; ++i)
+        removals_at_age[i] = numbers[i] * exploitation * selectivity_values[i] * exp_values[i];
     }
 
   } // if (model_->state() != State::kInitialise )
@@ -641,22 +665,22 @@ void MortalityInstantaneous::DoExecute() {
   /**
    * Remove the stock now using the exploitation rate
    */
-  unsigned category_ndx = 0;
   for (auto& category : categories_) {
-    for (unsigned i = 0; i < category.category_->data_.size(); ++i) {
-      //removals_by_category_age_[category_ndx][i] = category.category_->data_[i]; // initial numbers before process
-      LOG_FINEST() << "numbers at age = " << category.category_->data_[i] << " age " << i + model_->min_age() << " exploitation = " << category.exploitation_[i] << " M = " << *category.m_;
-      category.category_->data_[i] *= exp(-(*category.m_) * ratio * category.selectivity_values_[i]) * (1 - category.exploitation_[i]);
-      if (category.category_->data_[i] < 0.0) {
-        LOG_CODE_ERROR() << " Fishing caused a negative partition : if (categories->data_[i] < 0.0), category.category_->data_[i] = " << category.category_->data_[i] << " i = " << i + 1
-            << "; numbers at age = " << category.category_->data_[i] << " age " << i + model_->min_age() << " exploitation = " << category.exploitation_[i] << " M = " << *category.m_;
+    unsigned age_spread = category.category_->data_.size();
+    Double m_ratio = -(*category.m_) * ratio;
+    Double* numbers = category.category_->data_.data();
+    const Double* selectivity_values = category.selectivity_values_.data();
+    const Double* exploitation = category.exploitation_.data();
+    for (unsigned i = 0; i < age_spread; ++i)
+      numbers[i] *= exp(m_ratio * selectivity_values[i]) * (1 - exploitation[i]);
+
+    for (unsigned i = 0; i < age_spread; ++i) {
+      if (numbers[i] < 0.0) {
+        LOG_CODE_ERROR() << " Fishing caused a negative partition : if (categories->data_[i] < 0.0), category.category_->data_[i] = " << numbers[i] << " i = " << i + 1
+            << "; numbers at age = " << numbers[i] << " age " << i + model_->min_age() << " exploitation = " << exploitation[i] << " M = " << *category.m_;
       }
-      //removals_by_category_age_[category_ndx][i] -= category.category_->data_[i]; // minus what was left thus keeping the difference
-
     }
-    ++category_ndx;
   }
-  //removals_by_year_category_age_[model_->current_year()] = removals_by_category_age_;
 }
 
 /*
@@ -831,6 +855,93 @@ bool MortalityInstantaneous::check_methods_for_removal_obs(vector<string> method
   return true;
 }
 
+/**
+ * Return the numbers at age removed by a fishery from a category in a year.
+ * An empty vector is returned when there were no removals.
+ *
+ * @param year The year
+ * @param fishery_label The fishery (method) label
+ * @param category_label The category label
+ * @return The removals at age
+ */
+vector<Double>& MortalityInstantaneous::removals(unsigned year, const string& fishery_label, const string& category_label) {
+  no_removals_.clear();
+  auto fishery_iter = fishery_category_index_.find(fishery_label);
+  if (fishery_iter == fishery_category_index_.end())
+    return no_removals_;
+  auto category_iter = fishery_iter->second.find(category_label);
+  if (category_iter == fishery_iter->second.end())
+    return no_removals_;
+  unsigned year_index = year - model_->start_year();
+  if (year < model_->start_year() || year_index >= removals_by_year_fishery_category_.size())
+    return no_removals_;
+
+  return removals_by_year_fishery_category_[year_index][category_iter->second];
+}
+
+/**
+ * Save the catches and exploitation calculated for each fishery and
+ * the removals by year, fishery and category. The removals are stored as
+ * a year/fishery/category label triple per entry with the ages as values.
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void MortalityInstantaneous::SaveState(Checkpoint& checkpoint) const {
+  for (auto& iter : fisheries_) {
+    checkpoint.Save("process[" + label_ + "].fishery[" + iter.first + "].actual_catches", iter.second.actual_catches_);
+    checkpoint.Save("process[" + label_ + "].fishery[" + iter.first + "].exploitation", iter.second.exploitation_by_year_);
+  }
+
+  vector<string> labels;
+  vector<Double> values;
+  for (unsigned year_index = 0; year_index < removals_by_year_fishery_category_.size(); ++year_index) {
+    for (unsigned i = 0; i < fishery_categories_.size(); ++i) {
+      const vector<Double>& removals = removals_by_year_fishery_category_[year_index][i];
+      if (removals.size() == 0)
+        continue;
+      labels.insert(labels.end(), { utilities::ToInline<unsigned, string>(model_->start_year() + year_index),
+          fishery_categories_[i].fishery_label_, fishery_categories_[i].category_label_ });
+      values.push_back(Double(removals.size()));
+      values.insert(values.end(), removals.begin(), removals.end());
+    }
+  }
+  checkpoint.Save("process[" + label_ + "].removals", labels);
+  checkpoint.Save("process[" + label_ + "].removals", values);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void MortalityInstantaneous::RestoreState(const Checkpoint& checkpoint) {
+  for (auto& iter : fisheries_) {
+    checkpoint.Restore("process[" + label_ + "].fishery[" + iter.first + "].actual_catches", iter.second.actual_catches_);
+    checkpoint.Restore("process[" + label_ + "].fishery[" + iter.first + "].exploitation", iter.second.exploitation_by_year_);
+  }
+
+  vector<string> labels;
+  vector<Double> values;
+  checkpoint.Restore("process[" + label_ + "].removals", labels);
+  checkpoint.Restore("process[" + label_ + "].removals", values);
+
+  for (auto& removals_by_fishery_category : removals_by_year_fishery_category_) {
+    for (auto& removals : removals_by_fishery_category)
+      removals.clear();
+  }
+
+  unsigned offset = 0;
+  for (unsigned i = 0; i + 2 < labels.size(); i += 3) {
+    unsigned year_index = utilities::ToInline<string, unsigned>(labels[i]) - model_->start_year();
+    unsigned size = (unsigned)AS_DOUBLE(values[offset]);
+    if (removals_by_year_fishery_category_.size() <= year_index)
+      removals_by_year_fishery_category_.resize(year_index + 1, vector<vector<Double>>(fishery_categories_.size()));
+    vector<Double>& removals = removals_by_year_fishery_category_[year_index][fishery_category_index_[labels[i + 1]][labels[i + 2]]];
+    removals.assign(values.begin() + offset + 1, values.begin() + offset + 1 + size);
+    offset += size + 1;
+  }
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
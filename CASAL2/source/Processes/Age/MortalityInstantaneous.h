@@ -34,6 +34,23 @@ using utilities::OrderedMap;
 
 // classes
 class MortalityInstantaneous : public Process {
+  /**
+   * CategoryData holds the natural mortality and exploitation by age for a category
+   */
+  struct CategoryData {
+      string                category_label_;
+      partition::Category*  category_;
+      Double*               m_;
+      vector<Double>        exploitation_;
+      vector<Double>        exp_values_;
+      string                selectivity_label_;
+      Selectivity*          selectivity_;
+      vector<Double>        selectivity_values_;
+      AgeWeight*            age_weight_ = nullptr;
+      string                age_weight_label_;
+      bool                  used_in_current_timestep_;
+    };
+
  /**
  * FisheryData holds all the information related to a fishery
  */
@@ -52,21 +69,9 @@ class MortalityInstantaneous : public Process {
     Double          uobs_fishery_;
     Double          exploitation_;
     Double*         m_;
+    vector<CategoryData*> categories_; // categories fished by this fishery, used for u_obs
   };
 
-  struct CategoryData {
-      string                category_label_;
-      partition::Category*  category_;
-      Double*               m_;
-      vector<Double>        exploitation_;
-      vector<Double>        exp_values_;
-      string                selectivity_label_;
-      Selectivity*          selectivity_;
-      vector<Double>        selectivity_values_;
-      AgeWeight*            age_weight_ = nullptr;
-      string                age_weight_label_;
-      bool                  used_in_current_timestep_;
-    };
   /**
    * FisheryCategoryData is used to store 1 Fishery x Category x Selectivity
    */
@@ -90,6 +95,8 @@ public:
   void                        DoReset() override final;
   void                        DoExecute() override final;
   void                        RebuildCache() override final;
+  void                        SaveState(Checkpoint& checkpoint) const override final;
+  void                        RestoreState(const Checkpoint& checkpoint) override final;
   void                        FillReportCache(ostringstream& cache) override final;
   void                        FillTabularReportCache(ostringstream& cache, bool first_run) override final;
   //
@@ -98,7 +105,7 @@ public:
   bool                       check_methods_for_removal_obs(vector<string> methods);
 
   // accessors
-  map<unsigned, map<string, map<string, vector<Double>>>>&  catch_at() { return removals_by_year_fishery_category_; };
+  vector<Double>&             removals(unsigned year, const string& fishery_label, const string& category_label);
 
   // set
   vector<unsigned>            set_years();
@@ -128,7 +135,14 @@ private:
   vector<string>              selectivity_labels_;
   vector<Selectivity*>        selectivities_;
   // members for observations
-  map<unsigned,  map<string, map<string, vector<Double>>>> removals_by_year_fishery_category_; // Year,  fishery, category
+  vector<vector<vector<Double>>> removals_by_year_fishery_category_; // [year_ndx][fishery_category_ndx][age_ndx]
+  map<string, map<string, unsigned>> fishery_category_index_; // fishery, category
+  vector<Double>              no_removals_;
+  // index tables resolved in DoBuild() for each time step
+  vector<vector<unsigned>>    fishery_categories_by_time_step_; // [time_step_ndx] fishery_category_ndx
+  vector<vector<FisheryData*>> fisheries_by_time_step_;
+  vector<vector<bool>>        categories_used_by_time_step_; // [time_step_ndx][category_ndx]
+  vector<Double>              mean_weights_; // [age_ndx]
   map<unsigned, map<string, vector<string>>> year_method_category_to_store_; // Year,  fishery, category
   // Members for reporting
   vector<unsigned>            time_steps_to_skip_applying_F_mortaltiy_;
@@ -11,6 +11,7 @@
 // headers
 #include "RecruitmentBevertonHolt.h"
 
+#include <algorithm>
 #include <numeric>
 #include <limits>
 
@@ -499,6 +500,51 @@ void RecruitmentBevertonHolt::FillTabularReportCache(ostringstream& cache, bool
 
 }
 
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void RecruitmentBevertonHolt::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].ssb_values", ssb_values_);
+  checkpoint.Save("process[" + label_ + "].true_ycs_values", true_ycs_values_);
+  checkpoint.Save("process[" + label_ + "].recruitment_values", recruitment_values_);
+  checkpoint.Save("process[" + label_ + "].year_counter", year_counter_);
+  checkpoint.Save("process[" + label_ + "].r0", r0_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void RecruitmentBevertonHolt::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].ssb_values", ssb_values_);
+  checkpoint.Restore("process[" + label_ + "].true_ycs_values", true_ycs_values_);
+  checkpoint.Restore("process[" + label_ + "].recruitment_values", recruitment_values_);
+  checkpoint.Restore("process[" + label_ + "].year_counter", year_counter_);
+  checkpoint.Restore("process[" + label_ + "].r0", r0_);
+}
+
+/**
+ * A year class strength only affects the recruitment in the year it is
+ * recruited (ssb_offset years later). If the year classes are standardised
+ * then changing one of the standardised years changes all of them.
+ *
+ * @param label The label of the addressable
+ * @param index The index of the addressable
+ * @return The first year affected by the addressable, 0 if it affects initialisation
+ */
+unsigned RecruitmentBevertonHolt::GetAddressableFirstYear(const string& label, const string& index) const {
+  unsigned year = 0;
+  if (label != PARAM_YCS_VALUES || !utilities::To<string, unsigned>(index, year))
+    return 0;
+
+  if (ycs_standardised_ && std::find(standardise_ycs_.begin(), standardise_ycs_.end(), year) != standardise_ycs_.end())
+    year = standardise_ycs_[0];
+  return year + ssb_offset_;
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
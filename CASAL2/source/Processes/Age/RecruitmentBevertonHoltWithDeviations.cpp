@@ -503,6 +503,47 @@ void RecruitmentBevertonHoltWithDeviations::FillTabularReportCache(ostringstream
 
 }
 
+/**
+ * Save the values this process has built up over the years run so far
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void RecruitmentBevertonHoltWithDeviations::SaveState(Checkpoint& checkpoint) const {
+  checkpoint.Save("process[" + label_ + "].ssb_values", ssb_values_);
+  checkpoint.Save("process[" + label_ + "].true_ycs_values", true_ycs_values_);
+  checkpoint.Save("process[" + label_ + "].recruitment_values", recruitment_values_);
+  checkpoint.Save("process[" + label_ + "].ycs_values", ycs_values_);
+  checkpoint.Save("process[" + label_ + "].r0", r0_);
+}
+
+/**
+ * Restore the values saved by SaveState()
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void RecruitmentBevertonHoltWithDeviations::RestoreState(const Checkpoint& checkpoint) {
+  checkpoint.Restore("process[" + label_ + "].ssb_values", ssb_values_);
+  checkpoint.Restore("process[" + label_ + "].true_ycs_values", true_ycs_values_);
+  checkpoint.Restore("process[" + label_ + "].recruitment_values", recruitment_values_);
+  checkpoint.Restore("process[" + label_ + "].ycs_values", ycs_values_);
+  checkpoint.Restore("process[" + label_ + "].r0", r0_);
+}
+
+/**
+ * A recruitment deviation only affects the recruitment in the year it
+ * is recruited (ssb_offset years later).
+ *
+ * @param label The label of the addressable
+ * @param index The index of the addressable
+ * @return The first year affected by the addressable, 0 if it affects initialisation
+ */
+unsigned RecruitmentBevertonHoltWithDeviations::GetAddressableFirstYear(const string& label, const string& index) const {
+  unsigned year = 0;
+  if (label != PARAM_DEVIATION_VALUES || !utilities::To<string, unsigned>(index, year))
+    return 0;
+  return year + ssb_offset_;
+}
+
 } /* namespace age */
 } /* namespace processes */
 } /* namespace niwa */
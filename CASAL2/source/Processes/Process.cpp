@@ -70,19 +70,44 @@ void Process::Reset(){
 }
 
 /**
- * Execute our process and any executors
+ * Execute our process and any executors.
+ *
+ * Most processes have no executors subscribed so the lookup is
+ * skipped and nothing is added to executors_.
  */
 void Process::Execute(unsigned year, const string& time_step_label) {
   LOG_FINEST() << label_;
-  for (auto executor : executors_[year][time_step_label])
-    executor->PreExecute();
+  const vector<Executor*>* executors = nullptr;
+  if (!executors_.empty()) {
+    auto year_iter = executors_.find(year);
+    if (year_iter != executors_.end()) {
+      auto iter = year_iter->second.find(time_step_label);
+      if (iter != year_iter->second.end())
+        executors = &iter->second;
+    }
+  }
+
+  Timings& timings = model_->timings();
+  if (executors) {
+    for (auto executor : *executors) {
+      Timings::Timer timer(timings, executor, nullptr, Timings::Method::kPreExecute);
+      executor->PreExecute();
+    }
+  }
 
   LOG_TRACE();
-  DoExecute();
+  {
+    Timings::Timer timer(timings, this, PARAM_PROCESS, Timings::Method::kExecute);
+    DoExecute();
+  }
   LOG_TRACE();
 
-  for (auto executor : executors_[year][time_step_label])
-    executor->Execute();
+  if (executors) {
+    for (auto executor : *executors) {
+      Timings::Timer timer(timings, executor, nullptr, Timings::Method::kExecute);
+      executor->Execute();
+    }
+  }
 }
 
 /**
@@ -21,6 +21,7 @@
 // Headers
 #include "BaseClasses/Object.h"
 #include "BaseClasses/Executor.h"
+#include "Model/Checkpoint.h"
 #include "Model/Model.h"
 
 namespace niwa {
@@ -56,6 +57,8 @@ public:
   virtual void                DoExecute() = 0;
   virtual void                FillReportCache(ostringstream& cache) { };
   virtual void                FillTabularReportCache(ostringstream& cache, bool first_run) { };
+  virtual void                SaveState(Checkpoint& checkpoint) const { };
+  virtual void                RestoreState(const Checkpoint& checkpoint) { };
 
   // accessors
   PartitionType               partition_structure() const { return partition_structure_; }
@@ -89,6 +89,21 @@ void Profile::NextStep() {
   }
 }
 
+/**
+ * Set the parameter to the value of a step directly so the profile
+ * points can be run out of order (e.g. on worker models). Step 0 is the
+ * lower bound and step point_count() - 1 is the upper bound.
+ *
+ * @param step The step to set the parameter to
+ */
+void Profile::SetStep(unsigned step) {
+  *target_ = lower_bound_ + step_size_ * step;
+  if (parameters_.Get(PARAM_SAME)->has_been_defined()) {
+    *same_target_ = *target_;
+    LOG_MEDIUM() << "Profiling with profile parameter = " <<  *target_  << " and same parameter = " << *same_target_;
+  }
+}
+
 void Profile::RestoreOriginalValue() {
   *target_ = original_value_;
   if (parameters_.Get(PARAM_SAME)->has_been_defined()) {
@@ -39,11 +39,13 @@ public:
   void                        Reset() { };
   void                        FirstStep();
   void                        NextStep();
+  void                        SetStep(unsigned step);
   void                        RestoreOriginalValue();
 
   // accessors
   string                      parameter() const { return parameter_; }
   unsigned                    steps() const { return steps_; }
+  unsigned                    point_count() const { return steps_ + 2; }
   Double                      value() const { return *target_; }
 
 private:
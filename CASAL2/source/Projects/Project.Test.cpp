@@ -15,6 +15,12 @@
 #include "Model/Model.h"
 #include "TestResources/TestFixtures/InternalEmptyModel.h"
 #include "DerivedQuantities/Manager.h"
+#include "Reports/Manager.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
 
 #include "Utilities/RandomNumberGenerator.h"
 
@@ -192,7 +198,7 @@ R"(
  */
 
 TEST_F(InternalEmptyModel,Projection_Run_lognormal) {
-  utilities::RandomNumberGenerator::Instance().Reset(3445u);
+  model_->random_number_generator().Reset(3445u);
   AddConfigurationLine(simple_model, __FILE__, 31);
   AddConfigurationLine(lognormal_project, __FILE__, 55);
   LoadConfiguration();
@@ -212,6 +218,62 @@ TEST_F(InternalEmptyModel,Projection_Run_lognormal) {
   }
 }
 
+/**
+ * Run the model with a report writer attached so the report files are written
+ */
+void StartWithReports(Model* model) {
+  reports::Manager* report_manager = model->managers().report();
+  std::thread report_thread([report_manager]() { report_manager->FlushReports(); });
+  model->Start(RunMode::kProjection);
+  report_manager->StopThread();
+  report_thread.join();
+}
+
+/**
+ * Read and remove a report file
+ */
+string TakeFile(const string& file_name) {
+  std::ifstream file(file_name.c_str());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  file.close();
+  std::remove(file_name.c_str());
+  return contents.str();
+}
+
+/**
+ * Each candidate starts from the checkpoint at the end of the historical
+ * years so the projections must be the same no matter how many threads are used
+ */
+TEST_F(InternalEmptyModel, Projection_Run_lognormal_Threads) {
+  AddConfigurationLine(simple_model, __FILE__, 31);
+  AddConfigurationLine(lognormal_project, __FILE__, 159);
+  AddConfigurationLine("@report projected_ycs\ntype project\nproject future_ycs\nfile_name projected_ycs.out", __FILE__, 251);
+  AddConfigurationLine("@report partition_2020\ntype partition\nyears 2020\ntime_step Mar_May\nfile_name partition_2020.out", __FILE__, 252);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.projection_candidates_ = 4;
+  parameters.threads_               = 1;
+  model_->global_configuration().set_run_parameters(parameters);
+  std::unique_ptr<Model> threaded_model = model_->CreateWorker(parameters);
+
+  StartWithReports(model_);
+  string serial_ycs       = TakeFile("projected_ycs.out");
+  string serial_partition = TakeFile("partition_2020.out");
+
+  parameters.threads_ = 3;
+  threaded_model->global_configuration().set_run_parameters(parameters);
+  StartWithReports(threaded_model.get());
+  string threaded_ycs       = TakeFile("projected_ycs.out");
+  string threaded_partition = TakeFile("partition_2020.out");
+
+  EXPECT_NE("", serial_ycs);
+  EXPECT_NE("", serial_partition);
+  EXPECT_EQ(serial_ycs, threaded_ycs);
+  EXPECT_EQ(serial_partition, threaded_partition);
+}
+
 
 } /* namespace projects */
 } /* namespace niwa */
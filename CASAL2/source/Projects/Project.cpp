@@ -72,6 +72,10 @@ void Project::Build() {
       LOG_ERROR() << "The addressable you have provided for use in a projection: " << parameter_ << " is not a type that is supported for projection modification";
       break;
   }
+
+  // Get Target Object variable.
+  target_object_ = model_->objects().FindObject(parameter_);
+
   DoBuild();
 }
 
@@ -101,6 +105,8 @@ void Project::Update(unsigned current_year) {
     LOG_FINEST() << "updating parameter";
     DoUpdate();
   }
+  // so anything calculated from the old value is recalculated
+  target_object_->AddressablesChanged();
 }
 
 /**
@@ -162,6 +168,35 @@ void Project::StoreValue(unsigned current_year) {
   LOG_FINEST() << "Storing value = " << stored_values_[current_year];
 }
 
+/**
+ * Save the current value of the parameter we project. The projection
+ * years change it so it must be put back before projecting again.
+ *
+ * @param checkpoint The checkpoint to save to
+ */
+void Project::SaveState(Checkpoint& checkpoint) const {
+  if (addressable_ != nullptr)
+    checkpoint.Save("project[" + label_ + "]", *addressable_);
+  else if (addressable_map_ != nullptr)
+    checkpoint.Save("project[" + label_ + "]", *addressable_map_);
+  else if (addressable_vector_ != nullptr)
+    checkpoint.Save("project[" + label_ + "]", *addressable_vector_);
+}
+
+/**
+ * Restore the value of the parameter we project
+ *
+ * @param checkpoint The checkpoint to restore from
+ */
+void Project::RestoreState(const Checkpoint& checkpoint) {
+  if (addressable_ != nullptr)
+    checkpoint.Restore("project[" + label_ + "]", *addressable_);
+  else if (addressable_map_ != nullptr)
+    checkpoint.Restore("project[" + label_ + "]", *addressable_map_);
+  else if (addressable_vector_ != nullptr)
+    checkpoint.Restore("project[" + label_ + "]", *addressable_vector_);
+}
+
 } /* namespace niwa */
 
 
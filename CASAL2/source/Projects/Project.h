@@ -21,6 +21,7 @@
 
 // headers
 #include "BaseClasses/Object.h"
+#include "Model/Checkpoint.h"
 #include "Model/Model.h"
 
 // namespaces
@@ -41,9 +42,12 @@ public:
   void                        Reset();
   void                        Update(unsigned current_year);
   void                        StoreValue(unsigned current_year);
+  void                        SaveState(Checkpoint& checkpoint) const;
+  void                        RestoreState(const Checkpoint& checkpoint);
 
   // accessors
   string                      parameter() { return parameter_; };
+  const vector<unsigned>&     years() const { return years_; }
   map<unsigned,Double>&       projected_parameters() { return projected_values_; };
 
 protected:
@@ -69,6 +73,7 @@ protected:
   vector<unsigned>            years_;
   string                      parameter_;
   Double                      original_value_ = 0;
+  base::Object*               target_object_ = nullptr;
   Double*                     addressable_ = nullptr;
   map<unsigned, Double>*      addressable_map_ = nullptr;
   vector<Double>*             addressable_vector_ = nullptr;
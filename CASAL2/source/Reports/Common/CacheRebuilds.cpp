@@ -0,0 +1,52 @@
+/**
+ * @file CacheRebuilds.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "CacheRebuilds.h"
+
+#include "AgeLengths/Manager.h"
+#include "Model/Managers.h"
+#include "Selectivities/Manager.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default Constructor
+ */
+CacheRebuilds::CacheRebuilds(Model* model) : Report(model) {
+  run_mode_     = (RunMode::Type)(RunMode::kBasic | RunMode::kEstimation | RunMode::kProjection | RunMode::kProfiling | RunMode::kMCMC | RunMode::kSimulation);
+  model_state_  = State::kFinalise;
+}
+
+/**
+ * Print the rebuilds and skipped rebuilds for each estimated object
+ */
+void CacheRebuilds::DoExecute() {
+  cache_ << "*" << type_ << "[" << label_ << "]" << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "block label type rebuilds skipped\n";
+  for (auto selectivity : model_->managers().selectivity()->objects()) {
+    if (selectivity->is_estimated())
+      cache_ << PARAM_SELECTIVITY << " " << selectivity->label() << " " << selectivity->type() << " "
+          << selectivity->cache_rebuilds() << " " << selectivity->cache_rebuilds_skipped() << "\n";
+  }
+  for (auto age_length : model_->managers().age_length()->objects()) {
+    if (age_length->is_estimated())
+      cache_ << PARAM_AGE_LENGTH << " " << age_length->label() << " " << age_length->type() << " "
+          << age_length->cache_rebuilds() << " " << age_length->cache_rebuilds_skipped() << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
@@ -0,0 +1,40 @@
+/**
+ * @file CacheRebuilds.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report prints how many times the cache of each estimated
+ * selectivity and age length was rebuilt when the model was reset,
+ * and how many rebuilds were skipped because none of its parameters
+ * had changed
+ */
+#ifndef SOURCE_REPORTS_CHILDREN_CACHEREBUILDS_H_
+#define SOURCE_REPORTS_CHILDREN_CACHEREBUILDS_H_
+
+// headers
+#include "Reports/Report.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+// class
+class CacheRebuilds : public niwa::Report {
+public:
+  CacheRebuilds(Model* model);
+  virtual                     ~CacheRebuilds() = default;
+  void                        DoValidate() override final { };
+  void                        DoBuild() override final { };
+  void                        DoExecute() override final;
+  void                        DoExecuteTabular() override final { };
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_CHILDREN_CACHEREBUILDS_H_ */
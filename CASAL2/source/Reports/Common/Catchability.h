@@ -30,7 +30,6 @@ public:
 
 
 private:
-  bool						  first_run_ = true;
   string            unit_;
 };
 
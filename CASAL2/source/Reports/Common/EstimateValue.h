@@ -34,9 +34,6 @@ public:
   void                        DoExecuteTabular() override final;
   void                        DoFinaliseTabular() override final;
 
-private:
-  // members
-  bool                        first_run_ = true;
 };
 
 } /* namespace reports */
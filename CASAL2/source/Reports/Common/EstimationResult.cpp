@@ -14,6 +14,7 @@
 #include "Minimisers/Minimiser.h"
 #include "Model/Managers.h"
 #include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
 
 // Namespaces
 namespace niwa {
@@ -74,6 +75,11 @@ void EstimationResult::DoExecute() {
     break;
   }
 
+  ObjectiveFunction& objective = model_->objective_function();
+  cache_ << PARAM_OBJECTIVE_CACHE_SIZE << ": " << objective.cache_size() << "\n";
+  cache_ << "objective_cache_hits: " << objective.cache_hits() << "\n";
+  cache_ << "objective_cache_misses: " << objective.cache_misses() << "\n";
+
   ready_for_writing_ = true;
 }
 
@@ -0,0 +1,53 @@
+/**
+ * @file ExecutionPlan.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "ExecutionPlan.h"
+
+#include "Model/Managers.h"
+#include "TimeSteps/Manager.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default Constructor
+ */
+ExecutionPlan::ExecutionPlan(Model* model) : Report(model) {
+  run_mode_     = (RunMode::Type)(RunMode::kBasic | RunMode::kEstimation | RunMode::kProjection | RunMode::kProfiling | RunMode::kSimulation);
+  model_state_  = State::kFinalise;
+}
+
+/**
+ * Turn on the profiling of the plans for every time step
+ */
+void ExecutionPlan::DoBuild() {
+  for (auto time_step : model_->managers().time_step()->ordered_time_steps())
+    time_step->set_profile_plan(true);
+}
+
+/**
+ * Print the calls and time spent in each entry of the plans
+ */
+void ExecutionPlan::DoExecute() {
+  cache_ << "*" << type_ << "[" << label_ << "]" << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "time_step label type calls seconds\n";
+  for (auto time_step : model_->managers().time_step()->ordered_time_steps()) {
+    for (auto& profile : time_step->plan_profile())
+      cache_ << time_step->label() << " " << profile.label_ << " " << profile.type_ << " " << profile.calls_ << " " << profile.seconds_ << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
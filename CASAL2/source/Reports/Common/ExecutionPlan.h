@@ -0,0 +1,39 @@
+/**
+ * @file ExecutionPlan.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report turns on profiling of the compiled time step plans and
+ * prints the number of calls and the time spent in each process and
+ * executor hook of each time step when the model finishes
+ */
+#ifndef SOURCE_REPORTS_CHILDREN_EXECUTIONPLAN_H_
+#define SOURCE_REPORTS_CHILDREN_EXECUTIONPLAN_H_
+
+// headers
+#include "Reports/Report.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+// class
+class ExecutionPlan : public niwa::Report {
+public:
+  ExecutionPlan(Model* model);
+  virtual                     ~ExecutionPlan() = default;
+  void                        DoValidate() override final { };
+  void                        DoBuild() override final;
+  void                        DoExecute() override final;
+  void                        DoExecuteTabular() override final { };
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_CHILDREN_EXECUTIONPLAN_H_ */
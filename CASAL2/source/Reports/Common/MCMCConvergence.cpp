@@ -0,0 +1,61 @@
+/**
+ * @file MCMCConvergence.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "MCMCConvergence.h"
+
+#include "MCMCs/Manager.h"
+#include "MCMCs/MCMC.h"
+#include "Model/Managers.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default Constructor
+ */
+MCMCConvergence::MCMCConvergence(Model* model) : Report(model) {
+  run_mode_     = RunMode::kMCMC;
+  model_state_  = State::kFinalise;
+}
+
+/**
+ *
+ */
+void MCMCConvergence::DoBuild() {
+  mcmc_ = model_->managers().mcmc()->active_mcmc();
+  if (!mcmc_)
+    LOG_CODE_ERROR() << "mcmc_ = model_->managers().mcmc()->active_mcmc();";
+}
+
+/**
+ * Print the R-hat and effective sample size for each estimate.
+ * These are only calculated when more than one chain has been run.
+ */
+void MCMCConvergence::DoExecute() {
+  const vector<mcmc::Convergence>& convergence = mcmc_->convergence();
+  if (convergence.size() == 0) {
+    LOG_FINE() << "No convergence diagnostics to report, they require more than one MCMC chain";
+    return;
+  }
+
+  cache_ << "*" << type_ << "[" << label_ << "]" << "\n";
+  cache_ << "chains: " << model_->global_configuration().mcmc_chains() << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "parameter r_hat effective_sample_size\n";
+  for (auto& parameter : convergence)
+    cache_ << parameter.parameter_ << " " << parameter.r_hat_ << " " << parameter.effective_sample_size_ << "\n";
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
@@ -0,0 +1,44 @@
+/**
+ * @file MCMCConvergence.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report prints the cross-chain convergence diagnostics (R-hat and
+ * effective sample size) for each estimate when running multiple
+ * MCMC chains with --chains
+ */
+#ifndef SOURCE_REPORTS_CHILDREN_MCMCCONVERGENCE_H_
+#define SOURCE_REPORTS_CHILDREN_MCMCCONVERGENCE_H_
+
+// headers
+#include "Reports/Report.h"
+
+// namespaces
+namespace niwa {
+class MCMC;
+
+namespace reports {
+
+// class
+class MCMCConvergence : public niwa::Report {
+public:
+  MCMCConvergence(Model* model);
+  virtual                     ~MCMCConvergence() = default;
+  void                        DoValidate() override final { };
+  void                        DoBuild() override final;
+  void                        DoExecute() override final;
+  void                        DoExecuteTabular() override final { };
+
+private:
+  MCMC*                       mcmc_ = nullptr;
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_CHILDREN_MCMCCONVERGENCE_H_ */
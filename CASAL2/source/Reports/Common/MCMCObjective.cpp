@@ -75,18 +75,17 @@ void MCMCObjective::DoExecute() {
     cache_ << "sample objective_score prior likelihood penalties additional_priors jacobians step_size acceptance_rate acceptance_rate_since_adapt\n";
   }
 
-  auto chain = mcmc_->chain();
-  unsigned element = chain.size() - 1;
-    cache_ << chain[element].iteration_ << " "
-        << AS_DOUBLE(chain[element].score_) << " "
-        << AS_DOUBLE(chain[element].prior_) << " "
-        << AS_DOUBLE(chain[element].likelihood_) << " "
-        << AS_DOUBLE(chain[element].penalty_) << " "
-        << AS_DOUBLE(chain[element].additional_priors_) << " "
-        << AS_DOUBLE(chain[element].jacobians_) << " "
-        << AS_DOUBLE(chain[element].step_size_) << " "
-        << AS_DOUBLE(chain[element].acceptance_rate_) << " "
-        << AS_DOUBLE(chain[element].acceptance_rate_since_adapt_) << "\n";
+  const mcmc::ChainLink& link = mcmc_->last_link();
+  cache_ << link.iteration_ << " "
+      << AS_DOUBLE(link.score_) << " "
+      << AS_DOUBLE(link.prior_) << " "
+      << AS_DOUBLE(link.likelihood_) << " "
+      << AS_DOUBLE(link.penalty_) << " "
+      << AS_DOUBLE(link.additional_priors_) << " "
+      << AS_DOUBLE(link.jacobians_) << " "
+      << AS_DOUBLE(link.step_size_) << " "
+      << AS_DOUBLE(link.acceptance_rate_) << " "
+      << AS_DOUBLE(link.acceptance_rate_since_adapt_) << "\n";
 
   ready_for_writing_ = true;
 }
@@ -60,9 +60,8 @@ void MCMCSample::DoExecute() {
   if (!mcmc_)
     LOG_CODE_ERROR() << "if (!mcmc_)";
 
-  auto chain = mcmc_->chain();
-  unsigned element = chain.size() - 1;
-    cache_ << utilities::String::join<Double>(chain[element].values_, " ") << "\n";
+  const mcmc::ChainLink& link = mcmc_->last_link();
+  cache_ << utilities::String::join<Double>(link.values_, " ") << "\n";
 
   ready_for_writing_ = true;
 }
@@ -0,0 +1,96 @@
+/**
+ * @file MultiStart.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "MultiStart.h"
+
+#include "Minimisers/Manager.h"
+#include "Minimisers/Minimiser.h"
+#include "Model/Managers.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+namespace {
+/**
+ * @param result The result of a minimisation
+ * @return A single word description of the result
+ */
+string ResultLabel(MinimiserResult::Type result) {
+  switch (result) {
+  case MinimiserResult::kSuccess:
+    return "success";
+  case MinimiserResult::kStepSizeTooSmallSuccess:
+    return "step_size_too_small_success";
+  case MinimiserResult::kError:
+    return "error";
+  case MinimiserResult::kTooManyIterations:
+    return "too_many_iterations";
+  case MinimiserResult::kTooManyEvaluations:
+    return "too_many_evaluations";
+  case MinimiserResult::kStepSizeTooSmall:
+    return "step_size_too_small";
+  default:
+    return "invalid";
+  }
+}
+}
+
+/**
+ * Default Constructor
+ */
+MultiStart::MultiStart(Model* model) : Report(model) {
+  run_mode_     = RunMode::kEstimation;
+  model_state_  = State::kFinalise;
+}
+
+/**
+ *
+ */
+void MultiStart::DoBuild() {
+  minimiser_ = model_->managers().minimiser()->active_minimiser();
+  if (!minimiser_)
+    LOG_CODE_ERROR() << "minimiser_ = model_->managers().minimiser()->active_minimiser();";
+}
+
+/**
+ * Print the objective function score, minimiser result and estimate
+ * values that each start finished at. These only exist when more than
+ * one start has been run.
+ */
+void MultiStart::DoExecute() {
+  const vector<minimiser::StartResult>& starts = minimiser_->start_results();
+  if (starts.size() == 0) {
+    LOG_FINE() << "No multi-start results to report, they require more than one start";
+    return;
+  }
+
+  cache_ << "*" << type_ << "[" << label_ << "]" << "\n";
+  cache_ << "starts: " << starts.size() << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "start score result converged optimum best";
+  for (const string& parameter : minimiser_->start_parameters())
+    cache_ << " " << parameter;
+  cache_ << "\n";
+
+  for (const minimiser::StartResult& start : starts) {
+    cache_ << start.start_ + 1 << " " << AS_DOUBLE(start.score_) << " " << ResultLabel(start.result_) << " " << (start.converged_ ? "true" : "false")
+        << " " << start.optimum_ << " " << (start.best_ ? "true" : "false");
+    for (const Double& value : start.values_)
+      cache_ << " " << AS_DOUBLE(value);
+    cache_ << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
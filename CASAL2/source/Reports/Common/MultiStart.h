@@ -0,0 +1,45 @@
+/**
+ * @file MultiStart.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report prints the result of each start when estimating from
+ * multiple jittered starting points with --starts. Converged starts
+ * are grouped in to optima, ordered from the lowest objective function
+ * score, and the start used for the MPD is flagged as the best.
+ */
+#ifndef SOURCE_REPORTS_CHILDREN_MULTISTART_H_
+#define SOURCE_REPORTS_CHILDREN_MULTISTART_H_
+
+// headers
+#include "Reports/Report.h"
+
+// namespaces
+namespace niwa {
+class Minimiser;
+
+namespace reports {
+
+// class
+class MultiStart : public niwa::Report {
+public:
+  MultiStart(Model* model);
+  virtual                     ~MultiStart() = default;
+  void                        DoValidate() override final { };
+  void                        DoBuild() override final;
+  void                        DoExecute() override final;
+  void                        DoExecuteTabular() override final { };
+
+private:
+  Minimiser*                  minimiser_ = nullptr;
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_CHILDREN_MULTISTART_H_ */
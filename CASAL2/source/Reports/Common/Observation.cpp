@@ -78,7 +78,7 @@ void Observation::DoExecute() {
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score pearsons_residuals\n";
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if(observation_->likelihood() == PARAM_BINOMIAL){
           resid =(comparison.observed_ - comparison.expected_) / sqrt((dc::ZeroFun(comparison.expected_, comparison.delta_) * (1 - dc::ZeroFun(comparison.expected_, comparison.delta_))) / comparison.adjusted_error_);
         } else if (observation_->likelihood() == PARAM_MULTINOMIAL) {
@@ -92,7 +92,7 @@ void Observation::DoExecute() {
         } else {
           LOG_CODE_ERROR() << "Unknown coded likelihood type should be dealt with in DoBuild(), if the pearsons residual is unknown for this likelihood set, pearsons_residual false";
         }
-        cache_ << iter->first << " " << comparison.category_ << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
+        cache_ << iter->first << " " << observation_->comparison_category(comparison.category_id_) << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
              << " " << AS_DOUBLE(comparison.observed_) - AS_DOUBLE(comparison.expected_) << " " << AS_DOUBLE(comparison.error_value_) << " " <<AS_DOUBLE(comparison.process_error_) << " "
              << AS_DOUBLE(comparison.adjusted_error_) << " " << AS_DOUBLE(comparison.score_) << " " << AS_DOUBLE(resid) << "\n";
       }
@@ -102,7 +102,7 @@ void Observation::DoExecute() {
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score normalised_residuals\n";
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
@@ -111,7 +111,7 @@ void Observation::DoExecute() {
         } else {
           LOG_CODE_ERROR() << "Unknown coded likelihood type should be dealt with in DoBuild(), if the pearsons residual is unknown for this likelihood set, pearsons_residual false";
         }
-        cache_ << iter->first << " " << comparison.category_ << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
+        cache_ << iter->first << " " << observation_->comparison_category(comparison.category_id_) << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
              << " " << AS_DOUBLE(comparison.observed_) - AS_DOUBLE(comparison.expected_) << " " << AS_DOUBLE(comparison.error_value_) << " " <<AS_DOUBLE(comparison.process_error_) << " "
              << AS_DOUBLE(comparison.adjusted_error_) << " " << AS_DOUBLE(comparison.score_) << " " << AS_DOUBLE(resid) << "\n";
       }
@@ -121,7 +121,7 @@ void Observation::DoExecute() {
     Double pearson_resid, normalised_resid;
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score pearsons_residuals normalised_residuals\n";
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           normalised_resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
@@ -132,7 +132,7 @@ void Observation::DoExecute() {
         } else {
           LOG_CODE_ERROR() << "Unknown coded likelihood type should be dealt with in DoBuild(), if the pearsons residual is unknown for this likelihood set, pearsons_residual false";
         }
-        cache_ << iter->first << " " << comparison.category_ << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
+        cache_ << iter->first << " " << observation_->comparison_category(comparison.category_id_) << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
              << " " << AS_DOUBLE(comparison.observed_) - AS_DOUBLE(comparison.expected_) << " " << AS_DOUBLE(comparison.error_value_) << " " <<AS_DOUBLE(comparison.process_error_)  << " "
              << AS_DOUBLE(comparison.adjusted_error_) << " " << AS_DOUBLE(comparison.score_) << " " << AS_DOUBLE(pearson_resid) << " " << AS_DOUBLE(normalised_resid) << "\n";
       }
@@ -141,8 +141,8 @@ void Observation::DoExecute() {
     // report raw residuals
     cache_ << "year category age length observed expected residual error_value process_error adjusted_error score\n";
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
-        cache_ << iter->first << " " << comparison.category_ << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
+      for (const obs::Comparison& comparison : iter->second) {
+        cache_ << iter->first << " " << observation_->comparison_category(comparison.category_id_) << " " << comparison.age_ << " " << AS_DOUBLE(comparison.length_) << " " << AS_DOUBLE(comparison.observed_) << " " << AS_DOUBLE(comparison.expected_)
              << " " << AS_DOUBLE(comparison.observed_) - AS_DOUBLE(comparison.expected_) << " " << AS_DOUBLE(comparison.error_value_) << " " << AS_DOUBLE(comparison.process_error_)  << " "
              << AS_DOUBLE(comparison.adjusted_error_) << " " << AS_DOUBLE(comparison.score_) << "\n";
       }
@@ -170,7 +170,7 @@ void Observation::DoExecuteTabular() {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       		bin = "1";
@@ -193,7 +193,7 @@ void Observation::DoExecuteTabular() {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       	} else if ((comparison.length_ == 0) & (comparison.age_ != 0)) {
@@ -215,7 +215,7 @@ void Observation::DoExecuteTabular() {
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
       if (!utilities::To<unsigned, string>(iter->first, year))
         LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
       	if((comparison.length_ == 0) & (comparison.age_ == 0)) {
       		// Biomass/abundance
       	} else if ((comparison.length_ == 0) & (comparison.age_ != 0)) {
@@ -238,7 +238,7 @@ void Observation::DoExecuteTabular() {
       for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
         if (!utilities::To<unsigned, string>(iter->first, year))
           LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-        for (obs::Comparison comparison : iter->second) {
+        for (const obs::Comparison& comparison : iter->second) {
         	if((comparison.length_ == 0) && (comparison.age_ == 0)) {
         		// Biomass/abundance
         	} else if ((comparison.length_ == 0) && (comparison.age_ != 0)) {
@@ -262,7 +262,7 @@ void Observation::DoExecuteTabular() {
       for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
         if (!utilities::To<unsigned, string>(iter->first, year))
           LOG_CODE_ERROR() << "Could not convert the value " << iter->first << " to a string for storage in the tabular report";
-        for (obs::Comparison comparison : iter->second) {
+        for (const obs::Comparison& comparison : iter->second) {
         	if((comparison.length_ == 0) && (comparison.age_ == 0)) {
         		// Biomass/abundance
         	} else if ((comparison.length_ == 0) && (comparison.age_ != 0)) {
@@ -288,20 +288,20 @@ void Observation::DoExecuteTabular() {
    */
   // Print fits
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	cache_ << comparison.expected_ << " ";
     }
   }
   // Print obs
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	cache_ << comparison.observed_ << " ";
     }
   }
   // Print resids
   Double resid = 0.0;
   for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-    for (obs::Comparison comparison : iter->second) {
+    for (const obs::Comparison& comparison : iter->second) {
     	resid = comparison.observed_ - comparison.expected_;
     	cache_ << AS_DOUBLE(resid) << " ";
     }
@@ -310,7 +310,7 @@ void Observation::DoExecuteTabular() {
     // Generate labels for the pearsons resids
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if(observation_->likelihood() == PARAM_BINOMIAL){
           resid =(comparison.observed_ - comparison.expected_) / sqrt((dc::ZeroFun(comparison.expected_, comparison.delta_) * (1 - dc::ZeroFun(comparison.expected_, comparison.delta_))) / comparison.adjusted_error_);
         } else if (observation_->likelihood() == PARAM_MULTINOMIAL) {
@@ -332,7 +332,7 @@ void Observation::DoExecuteTabular() {
     // Generate labels for the normalised resids
     Double resid;
     for (auto iter = comparisons.begin(); iter != comparisons.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         if (observation_->likelihood() == PARAM_LOGNORMAL) {
           Double sigma =  sqrt(log(1 + comparison.adjusted_error_ * comparison.adjusted_error_));
           resid = (log(comparison.observed_ / comparison.expected_) + 0.5 * sigma * sigma) / sigma;
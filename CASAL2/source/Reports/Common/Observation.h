@@ -41,7 +41,6 @@ private:
   niwa::Observation*  observation_;
   bool                normalised_resids_ = false;
   bool                pearson_resids_ = false;
-  bool								first_run_ = true;
 };
 
 } /* namespace reports */
@@ -35,9 +35,6 @@ public:
   void                        DoBuild() override final { };
   void                        DoExecute() override final;
   void                        DoExecuteTabular() override final { };
-private:
-  // members
-  bool                        first_run_ = true;
 };
 
 } /* namespace reports */
@@ -38,7 +38,6 @@ public:
 private:
   string                      process_label_ = "";
   niwa::Process*              process_ = nullptr;
-  bool                        first_run_ = true;
 
 };
 
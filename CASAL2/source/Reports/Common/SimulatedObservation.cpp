@@ -81,7 +81,7 @@ void SimulatedObservation::DoExecute() {
     // biomass obs
     cache_ << PARAM_OBS << " ";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second)
+      for (const obs::Comparison& comparison : iter->second)
         cache_ << comparison.observed_ << " ";
     }
     cache_ << "\n";
@@ -90,7 +90,7 @@ void SimulatedObservation::DoExecute() {
     cache_ << PARAM_TABLE << " " << PARAM_OBS << "\n";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
       cache_ << iter->first << " ";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         cache_ << AS_DOUBLE(comparison.observed_) << " ";
       }
       cache_ << "\n";
@@ -105,7 +105,7 @@ void SimulatedObservation::DoExecute() {
     // biomass error
     cache_ << PARAM_ERROR_VALUE << " ";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
-      for (obs::Comparison comparison : iter->second)
+      for (const obs::Comparison& comparison : iter->second)
         cache_ << comparison.error_value_ << " ";
     }
     cache_ << "\n";
@@ -114,7 +114,7 @@ void SimulatedObservation::DoExecute() {
     cache_ << PARAM_TABLE << " " << PARAM_ERROR_VALUES << "\n";
     for (auto iter = comparison.begin(); iter != comparison.end(); ++iter) {
       cache_ << iter->first << " ";
-      for (obs::Comparison comparison : iter->second) {
+      for (const obs::Comparison& comparison : iter->second) {
         cache_ << AS_DOUBLE(comparison.error_value_) << " ";
       }
       cache_ << "\n";
@@ -30,10 +30,6 @@ public:
   void                        DoExecute() override final;
   void                        DoExecuteTabular() override final;
   void                        DoFinaliseTabular() override final;
-
-
-private:
-  bool						  first_run_ = true;
 };
 
 } /* namespace reports */
@@ -0,0 +1,51 @@
+/**
+ * @file Timing.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// headers
+#include "Timing.h"
+
+#include "Model/Model.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * Default Constructor
+ */
+Timing::Timing(Model* model) : Report(model) {
+  run_mode_     = (RunMode::Type)(RunMode::kBasic | RunMode::kEstimation | RunMode::kProjection | RunMode::kProfiling | RunMode::kSimulation | RunMode::kMCMC);
+  model_state_  = State::kFinalise;
+}
+
+/**
+ * Turn on the timings for the model
+ */
+void Timing::DoBuild() {
+  model_->timings().set_enabled(true);
+}
+
+/**
+ * Print the calls and time spent in each timed method
+ */
+void Timing::DoExecute() {
+  cache_ << "*" << type_ << "[" << label_ << "]" << "\n";
+  cache_ << "values " << REPORT_R_DATAFRAME << "\n";
+  cache_ << "type label method calls seconds seconds_per_call\n";
+  for (auto& entry : model_->timings().entries()) {
+    double seconds_per_call = entry.calls_ == 0 ? 0.0 : entry.seconds_ / entry.calls_;
+    cache_ << entry.type_ << " " << entry.label_ << " " << entry.method_ << " " << entry.calls_ << " " << entry.seconds_ << " " << seconds_per_call << "\n";
+  }
+
+  ready_for_writing_ = true;
+}
+
+} /* namespace reports */
+} /* namespace niwa */
@@ -0,0 +1,39 @@
+/**
+ * @file Timing.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * This report turns on the model timings and prints the number of calls
+ * and the time spent in each process, observation, derived quantity,
+ * initialisation phase and report when the model finishes
+ */
+#ifndef SOURCE_REPORTS_CHILDREN_TIMING_H_
+#define SOURCE_REPORTS_CHILDREN_TIMING_H_
+
+// headers
+#include "Reports/Report.h"
+
+// namespaces
+namespace niwa {
+namespace reports {
+
+// class
+class Timing : public niwa::Report {
+public:
+  Timing(Model* model);
+  virtual                     ~Timing() = default;
+  void                        DoValidate() override final { };
+  void                        DoBuild() override final;
+  void                        DoExecute() override final;
+  void                        DoExecuteTabular() override final { };
+};
+
+} /* namespace reports */
+} /* namespace niwa */
+
+#endif /* SOURCE_REPORTS_CHILDREN_TIMING_H_ */
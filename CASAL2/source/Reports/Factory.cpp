@@ -25,6 +25,7 @@
 #include "Reports/Age/Partition.h"
 #include "Reports/Age/PartitionYearCrossAgeMatrix.h"
 #include "Reports/Common/Addressable.h"
+#include "Reports/Common/CacheRebuilds.h"
 #include "Reports/Common/CategoryInfo.h"
 #include "Reports/Common/Catchability.h"
 #include "Reports/Common/CategoryList.h"
@@ -35,11 +36,14 @@
 #include "Reports/Common/EstimateSummary.h"
 #include "Reports/Common/EstimateValue.h"
 #include "Reports/Common/EstimationResult.h"
+#include "Reports/Common/ExecutionPlan.h"
 #include "Reports/Common/HessianMatrix.h"
+#include "Reports/Common/MCMCConvergence.h"
 #include "Reports/Common/MCMCCovariance.h"
 #include "Reports/Common/MCMCObjective.h"
 #include "Reports/Common/MCMCSample.h"
 #include "Reports/Common/MPD.h"
+#include "Reports/Common/MultiStart.h"
 #include "Reports/Common/ObjectiveFunction.h"
 #include "Reports/Common/Observation.h"
 #include "Reports/Common/InitialisationPartition.h"
@@ -50,6 +54,7 @@
 #include "Reports/Common/SimulatedObservation.h"
 #include "Reports/Common/Selectivity.h"
 #include "Reports/Common/TimeVarying.h"
+#include "Reports/Common/Timing.h"
 #include "Reports/Length/InitialisationPartitionMeanWeight.h"
 #include "Reports/Length/PartitionMeanWeight.h"
 #include "Reports/Length/PartitionBiomass.h"
@@ -75,6 +80,8 @@ Report* Factory::Create(Model* model, const string& object_type, const string& s
       result = new CategoryInfo(model);
     else if (sub_type == PARAM_CATEGORY_LIST)
       result = new CategoryList(model);
+    else if (sub_type == PARAM_CACHE_REBUILDS)
+      result = new CacheRebuilds(model);
     else if (sub_type == PARAM_CATCHABILITY)
       result = new Catchability(model);
     else if (sub_type == PARAM_COVARIANCE_MATRIX)
@@ -93,12 +100,18 @@ Report* Factory::Create(Model* model, const string& object_type, const string& s
       result = new EstimateValue(model);
     else if (sub_type == PARAM_ESTIMATION_RESULT)
       result = new EstimationResult(model);
+    else if (sub_type == PARAM_EXECUTION_PLAN)
+      result = new ExecutionPlan(model);
     else if (sub_type == PARAM_HESSIAN_MATRIX)
       result = new HessianMatrix(model);
+    else if (sub_type == PARAM_MCMC_CONVERGENCE)
+      result = new MCMCConvergence(model);
     else if (sub_type == PARAM_MCMC_COVARIANCE)
       result = new MCMCCovariance(model);
     else if (sub_type == PARAM_MCMC_OBJECTIVE)
       result = new MCMCObjective(model);
+    else if (sub_type == PARAM_MULTI_START)
+      result = new MultiStart(model);
     else if (sub_type == PARAM_MCMC_SAMPLE)
       result = new MCMCSample(model);
     else if (sub_type == PARAM_MPD)
@@ -121,6 +134,8 @@ Report* Factory::Create(Model* model, const string& object_type, const string& s
       result = new Selectivity(model);
     else if (sub_type == PARAM_TIME_VARYING)
       result = new TimeVarying(model);
+    else if (sub_type == PARAM_TIMING)
+      result = new Timing(model);
     else if (sub_type == PARAM_INITIALISATION_PARTITION)
       result = new InitialisationPartition(model);
     else if (model->partition_type() == PartitionType::kAge) {
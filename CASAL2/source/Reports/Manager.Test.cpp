@@ -0,0 +1,94 @@
+/**
+ * @file Manager.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "Manager.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "Model/Model.h"
+#include "Model/Managers.h"
+
+// Namespaces
+namespace niwa {
+namespace reports {
+
+/**
+ * A minimal report that writes a single line each time it executes
+ */
+class QueueTestReport : public niwa::Report {
+public:
+  QueueTestReport(Model* model, const string& file_name) : Report(model) {
+    run_mode_    = RunMode::kBasic;
+    model_state_ = State::kExecute;
+    file_name_   = file_name;
+    skip_tags_   = true;
+  }
+  void DoValidate() override final { };
+  void DoBuild() override final { };
+  void DoExecute() override final { cache_ << "line " << ++count_ << "\n"; ready_for_writing_ = true; };
+  void DoExecuteTabular() override final { };
+
+  unsigned count_ = 0;
+};
+
+inline string ReadFile(const string& file_name) {
+  std::ifstream file(file_name.c_str());
+  std::stringstream contents;
+  contents << file.rdbuf();
+  return contents.str();
+}
+
+/**
+ * Every execution is queued and written in order by the writer thread,
+ * including output that was queued before the thread started and while
+ * the writer was paused. The report cache is released straight away.
+ */
+TEST(Reports_Manager, WriterThreadWritesQueuedOutput) {
+  string file_name = "Reports_Manager_Writer.out";
+  std::remove(file_name.c_str());
+
+  Model model;
+  Manager* manager = model.managers().report();
+  QueueTestReport report(&model, file_name);
+
+  report.Execute();
+  EXPECT_FALSE(report.ready_for_writing());
+
+  std::thread writer([&manager]() { manager->FlushReports(); });
+
+  for (unsigned i = 0; i < 1000; ++i) {
+    report.Execute();
+    EXPECT_FALSE(report.ready_for_writing());
+  }
+
+  manager->Pause();
+  report.Execute();
+  manager->Resume();
+
+  manager->WaitForReportsToFinish();
+  manager->StopThread();
+  writer.join();
+
+  std::ostringstream expected;
+  for (unsigned i = 1; i <= 1002; ++i)
+    expected << "line " << i << "\n";
+  EXPECT_EQ(expected.str(), ReadFile(file_name));
+  std::remove(file_name.c_str());
+}
+
+} /* namespace reports */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -18,10 +18,6 @@ namespace reports {
  * Default Constructor
  */
 Manager::Manager(Model* model) : model_(model) {
-  run_.test_and_set();
-  pause_ = false;
-  is_paused_ = false;
-  waiting_ = false;
 }
 
 /**
@@ -71,6 +67,7 @@ void Manager::Execute(State::Type model_state) {
   for(auto report : state_reports_[model_state]) {
       LOG_FINE() << "Checking report: " << report->label();
       if ( (RunMode::Type)(report->run_mode() & run_mode) == run_mode) {
+        Timings::Timer timer(model_->timings(), report, PARAM_REPORT, Timings::Method::kExecute);
         if (tabular)
           report->ExecuteTabular();
         else
@@ -105,6 +102,7 @@ void Manager::Execute(unsigned year, const string& time_step_label) {
       continue;
     }
 
+    Timings::Timer timer(model_->timings(), report, PARAM_REPORT, Timings::Method::kExecute);
     if (tabular)
       report->ExecuteTabular();
     else
@@ -113,6 +111,43 @@ void Manager::Execute(unsigned year, const string& time_step_label) {
   LOG_TRACE();
 }
 
+/**
+ * Check if any reports would be executed at the end of a time step
+ * when the model is running in this run mode
+ *
+ * @param run_mode The run mode to check
+ * @return true if there is at least one report, false otherwise
+ */
+bool Manager::HasTimeStepReports(RunMode::Type run_mode) const {
+  for (auto& iter : time_step_reports_) {
+    for (auto report : iter.second) {
+      if ( (RunMode::Type)(report->run_mode() & run_mode) == run_mode)
+        return true;
+    }
+  }
+  return false;
+}
+
+/**
+ * Check if any reports would be executed when the model
+ * enters this state in this run mode
+ *
+ * @param model_state The state to check
+ * @param run_mode The run mode to check
+ * @return true if there is at least one report, false otherwise
+ */
+bool Manager::HasStateReports(State::Type model_state, RunMode::Type run_mode) const {
+  auto iter = state_reports_.find(model_state);
+  if (iter == state_reports_.end())
+    return false;
+
+  for (auto report : iter->second) {
+    if ( (RunMode::Type)(report->run_mode() & run_mode) == run_mode)
+      return true;
+  }
+  return false;
+}
+
 /**
  *
  */
@@ -157,64 +192,183 @@ void Manager::Finalise() {
 
 /**
  * This method can be called from the main thread to ensure
- * we wait for all reports to finish
+ * we wait for all reports to finish. It returns once the writer
+ * thread has emptied the queue and is no longer writing.
  */
 void Manager::WaitForReportsToFinish() {
-#ifndef TESTMODE
-  waiting_ = true;
   LOG_FINE() << "Waiting for reports";
-  while(waiting_);
-#endif
-  return;
+  std::unique_lock<std::mutex> lock(queue_lock_);
+  queue_drained_.wait(lock, [this]() { return !writer_attached_ || (queue_.empty() && !writing_); });
+}
+
+/**
+ * Hand the cached output of a report to the writer thread.
+ *
+ * When the queue is full we block until the writer has caught up
+ * so a long run cannot grow the queue without bound. If there is no
+ * writer thread attached yet (or at all, e.g. unit tests) the output is
+ * held on the queue until one is.
+ *
+ * @param report The report that owns the output
+ * @param contents The text to write
+ */
+void Manager::Enqueue(Report* report, const string& contents) {
+  std::unique_lock<std::mutex> lock(queue_lock_);
+  // Don't block while paused, the writer won't drain the queue until we resume
+  queue_drained_.wait(lock, [this]() { return !writer_attached_ || paused_ || queue_.size() < max_queue_size_; });
+  queue_.push_back(QueuedOutput { report, contents, report_suffix_ });
+  queue_changed_.notify_one();
+}
+
+/**
+ * Queue output that was taken from another manager (see TakeQueue()).
+ * The output keeps the suffix it was created with and is written
+ * in the order given. Output from a report with the same label as one of
+ * ours is written by our report so it carries on from what we have already
+ * written to that file instead of overwriting it.
+ *
+ * @param outputs The output to queue, this is emptied
+ */
+void Manager::Enqueue(std::deque<QueuedOutput>& outputs) {
+  for (QueuedOutput& output : outputs) {
+    for (Report* report : objects_) {
+      if (report->label() == output.report_->label()) {
+        output.report_ = report;
+        break;
+      }
+    }
+  }
+
+  std::unique_lock<std::mutex> lock(queue_lock_);
+  for (QueuedOutput& output : outputs) {
+    queue_drained_.wait(lock, [this]() { return !writer_attached_ || paused_ || queue_.size() < max_queue_size_; });
+    queue_.push_back(std::move(output));
+    queue_changed_.notify_one();
+  }
+  outputs.clear();
+}
+
+/**
+ * Remove everything waiting on the queue and hand it to the caller.
+ * This is used to collect the output of worker models that do not have
+ * their own writer thread so it can be written by the main model.
+ *
+ * @return The queued output in the order it was queued
+ */
+std::deque<Manager::QueuedOutput> Manager::TakeQueue() {
+  std::lock_guard<std::mutex> lock(queue_lock_);
+  std::deque<QueuedOutput> result;
+  result.swap(queue_);
+  queue_drained_.notify_all();
+  return result;
 }
 
 /**
- * This method will flush all of the reports to stdout or a file depending on each
- * report when it has finished caching it's output internally.
+ * Take the output each report is holding in its cache (see Report::TakeCache()).
+ * This is used with TakeQueue() to collect all of the output of a worker model.
+ *
+ * @return The output of each report that has some, by report label
+ */
+map<string, string> Manager::TakeCaches() {
+  map<string, string> result;
+  for (Report* report : objects_) {
+    string contents = report->TakeCache();
+    if (contents != "")
+      result[report->label()] = contents;
+  }
+  return result;
+}
+
+/**
+ * Add the output taken from another manager's reports (see TakeCaches())
+ * to the caches of our reports with the same labels
+ *
+ * @param caches The output of each report by report label
+ */
+void Manager::AppendCaches(const map<string, string>& caches) {
+  for (Report* report : objects_) {
+    auto iter = caches.find(report->label());
+    if (iter != caches.end())
+      report->AppendCache(iter->second);
+  }
+}
+
+/**
+ * Set whether the reports print their header with their next output.
+ * A worker model that runs part of the rows of a -i file only prints
+ * the header if it runs the first row.
+ *
+ * @param first_run true if the reports should print their header
+ */
+void Manager::SetFirstRun(bool first_run) {
+  for (Report* report : objects_)
+    report->set_first_run(first_run);
+}
+
+/**
+ * This method will write the output of the reports to stdout or a file depending on each
+ * report as they are queued by Enqueue(). The thread sleeps until there is something
+ * to write, so it does not use any CPU while the model is running.
  *
  * NOTE: This method is called in it's own thread so we can continue to run the model
  * without having to wait for the reports to be ready.
  */
 void Manager::FlushReports() {
   // WARNING: DO NOT CALL THIS ANYWHERE. IT'S THREADED
- bool do_break = run_.test_and_set();
- waiting_ = false;
- bool record_waiting = false;
-  while(true) {
-    while (pause_) {
-      is_paused_ = true;
-      continue;
-    }
+  std::unique_lock<std::mutex> lock(queue_lock_);
+  writer_attached_ = true;
+  while (true) {
+    // Once stopped we ignore pause so the queue is always emptied
+    queue_changed_.wait(lock, [this]() { return !run_ || (!paused_ && !queue_.empty()); });
+    if (queue_.empty())
+      break;
 
-    is_paused_ = false;
+    QueuedOutput output = std::move(queue_.front());
+    queue_.pop_front();
+    writing_ = true;
+    lock.unlock();
+    queue_drained_.notify_all();
 
-    if (waiting_)
-      record_waiting = true;
+    output.report_->Write(output.contents_, output.suffix_);
 
-    do_break = !run_.test_and_set();
-    for (auto report : objects_) {
-      if (report->ready_for_writing())
-        report->FlushCache();
-    }
+    lock.lock();
+    writing_ = false;
+    queue_drained_.notify_all();
+  }
 
-    if (record_waiting) {
-      record_waiting = false;
-      waiting_ = false;
-    }
+  writer_attached_ = false;
+  lock.unlock();
+  queue_drained_.notify_all();
+}
 
-    if (do_break)
-      break;
-  }
+/**
+ * Tell the writer thread to finish. Anything left
+ * on the queue is written before the thread exits.
+ */
+void Manager::StopThread() {
+  std::lock_guard<std::mutex> lock(queue_lock_);
+  run_ = false;
+  queue_changed_.notify_all();
 }
 
 /**
- *
+ * Stop writing reports until Resume() is called. We
+ * wait for the writer to empty the queue first so the
+ * output is complete before we pause.
  */
 void Manager::Pause() {
-#ifndef TESTMODE
-  pause_ = true;
-  while(!is_paused_) continue;
-#endif
+  std::unique_lock<std::mutex> lock(queue_lock_);
+  queue_drained_.wait(lock, [this]() { return !writer_attached_ || (queue_.empty() && !writing_); });
+  paused_ = true;
+}
+
+/**
+ *
+ */
+void Manager::Resume() {
+  std::lock_guard<std::mutex> lock(queue_lock_);
+  paused_ = false;
+  queue_changed_.notify_all();
 }
 
 } /* namespace reports */
@@ -17,7 +17,9 @@
 #define REPORTS_MANAGER_H_
 
 // Headers
-#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
 
 #include "BaseClasses/Manager.h"
 #include "Reports/Report.h"
@@ -35,17 +37,32 @@ class Manager : public niwa::base::Manager<reports::Manager, niwa::Report> {
   friend class niwa::base::Manager<reports::Manager, niwa::Report>;
   friend class niwa::Managers;
 public:
+  // Structs
+  struct QueuedOutput {
+    Report*   report_;
+    string    contents_;
+    string    suffix_;
+  };
+
   // methods
   virtual                     ~Manager() noexcept(true);
   void                        Build() override final;
   void                        Execute(State::Type model_state);
   void                        Execute(unsigned year, const string& time_step_label);
+  bool                        HasTimeStepReports(RunMode::Type run_mode) const;
+  bool                        HasStateReports(State::Type model_state, RunMode::Type run_mode) const;
   void                        Prepare();
   void                        Finalise();
+  void                        Enqueue(Report* report, const string& contents);
+  void                        Enqueue(std::deque<QueuedOutput>& outputs);
+  std::deque<QueuedOutput>    TakeQueue();
+  map<string, string>         TakeCaches();
+  void                        AppendCaches(const map<string, string>& caches);
+  void                        SetFirstRun(bool first_run);
   void                        FlushReports();
-  void                        StopThread() { run_.clear(); }
+  void                        StopThread();
   void                        Pause();
-  void                        Resume() { pause_ = false; }
+  void                        Resume();
   void                        WaitForReportsToFinish();
 
   // accessors
@@ -64,12 +81,17 @@ private:
   map<State::Type, vector<Report*>> state_reports_;
   map<string, vector<Report*>>      time_step_reports_;
   string                            report_suffix_ = "";
-  std::atomic<bool>                 pause_;
-  std::atomic<bool>                 is_paused_;
-  std::atomic_flag                  run_;
-  std::atomic<bool>                 waiting_;
   Model*                            model_;
   std::string                       std_header_ = "";
+  std::deque<QueuedOutput>          queue_;
+  std::mutex                        queue_lock_;
+  std::condition_variable           queue_changed_; // signalled when output is queued or the writer is stopped/resumed
+  std::condition_variable           queue_drained_; // signalled when the writer takes output off the queue or goes idle
+  const unsigned                    max_queue_size_ = 256;
+  bool                              writer_attached_ = false;
+  bool                              writing_ = false;
+  bool                              paused_ = false;
+  bool                              run_ = true;
 };
 
 } /* namespace reports */
@@ -106,6 +106,7 @@ void Report::Prepare() {
 void Report::Execute() {
   Report::lock_.lock();
   DoExecute();
+  QueueCache();
   Report::lock_.unlock();
 }
 
@@ -115,6 +116,7 @@ void Report::Execute() {
 void Report::Finalise() {
   Report::lock_.lock();
   DoFinalise();
+  QueueCache();
   Report::lock_.unlock();
 };
 
@@ -143,6 +145,7 @@ void Report::PrepareTabular() {
 void Report::ExecuteTabular() {
   Report::lock_.lock();
   DoExecuteTabular();
+  QueueCache();
   Report::lock_.unlock();
 }
 
@@ -152,6 +155,7 @@ void Report::ExecuteTabular() {
 void Report::FinaliseTabular() {
   Report::lock_.lock();
   DoFinaliseTabular();
+  QueueCache();
   Report::lock_.unlock();
 }
 
@@ -184,17 +188,59 @@ void Report::SetUpInternalStates() {
 }
 
 /**
- * Flush the contents of the cache to the file or stdout/stderr
+ * Hand our cache to the report manager's writer
+ * thread if the report has finished writing to it.
+ *
+ * NOTE: Report::lock_ must be held by the caller
  */
-void Report::FlushCache() {
-  Report::lock_.lock();
+void Report::QueueCache() {
+  if (!ready_for_writing_)
+    return;
+
+  model_->managers().report()->Enqueue(this, cache_.str());
+  cache_.clear();
+  cache_.str("");
+  ready_for_writing_ = false;
+}
+
+/**
+ * Take the output that has not been handed to the writer yet. Tabular
+ * reports keep their output until they are finalised so this is used to
+ * move the output of a worker model to the same report in the main model.
+ *
+ * @return The output in the cache
+ */
+string Report::TakeCache() {
+  std::lock_guard<std::mutex> lock(Report::lock_);
+  string contents = cache_.str();
+  cache_.clear();
+  cache_.str("");
+  return contents;
+}
+
+/**
+ * Add output taken from a worker model's report (see TakeCache())
+ * to the end of our cache
+ *
+ * @param contents The output to add
+ */
+void Report::AppendCache(const string& contents) {
+  std::lock_guard<std::mutex> lock(Report::lock_);
+  cache_ << contents;
+}
 
+/**
+ * Write the contents to the file or stdout/stderr. This is
+ * called from the report manager's writer thread.
+ *
+ * @param contents The report output to write
+ * @param suffix The report suffix at the time the output was created
+ */
+void Report::Write(const string& contents, const string& suffix) {
   /**
    * Are we writing to a file?
    */
   if (file_name_ != "") {
-    string suffix = model_->managers().report()->report_suffix();
-
     bool overwrite = false;
     if (first_write_ || suffix != last_suffix_)
       overwrite = overwrite_;
@@ -213,17 +259,15 @@ void Report::FlushCache() {
       LOG_ERROR() << "Unable to open file: " << file_name;
 
     LOG_MEDIUM() << "skip tags = " << skip_tags_;
-    if (!skip_tags_) {
-      cache_ << CONFIG_END_REPORT << "\n";
-      //cerr << "end report\n";
-    }
-    file << cache_.str();
+    file << contents;
+    if (!skip_tags_)
+      file << CONFIG_END_REPORT << "\n";
     file.close();
 
     first_write_ = false;
 
   } else {
-    cout << cache_.str();
+    cout << contents;
     if (!skip_tags_) {
       cout << CONFIG_END_REPORT << "\n";
     }
@@ -233,11 +277,6 @@ void Report::FlushCache() {
 
     first_write_ = false;
   }
-
-  cache_.clear();
-  cache_.str("");
-  ready_for_writing_ = false;
-  Report::lock_.unlock();
 }
 
 } /* namespace niwa */
@@ -62,7 +62,9 @@ public:
   void                        ExecuteTabular();
   void                        FinaliseTabular();
   bool                        HasYear(unsigned year);
-  void                        FlushCache();
+  void                        Write(const string& contents, const string& suffix);
+  string                      TakeCache();
+  void                        AppendCache(const string& contents);
 
   // Accessors
   RunMode::Type               run_mode() const { return run_mode_; }
@@ -70,10 +72,12 @@ public:
   const string&               time_step() const { return time_step_; }
   bool                        ready_for_writing() const { return ready_for_writing_; }
   void                        set_skip_tags(bool value) { skip_tags_ = value; }
+  void                        set_first_run(bool value) { first_run_ = value; }
 
 protected:
   // methods
   void                        SetUpInternalStates();
+  void                        QueueCache();
   // pure methods
   virtual void                DoValidate() = 0;
   virtual void                DoBuild() = 0;
@@ -99,6 +103,7 @@ protected:
   ostringstream               cache_;
   bool                        ready_for_writing_ = false;
   bool                        skip_tags_ = false;
+  bool                        first_run_ = true; // print the header with the next output
 };
 
 // Typedef
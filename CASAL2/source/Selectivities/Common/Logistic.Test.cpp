@@ -108,6 +108,44 @@ TEST(Selectivities, Logistic_Length) {
 
 }
 
+/**
+ * Test an estimated selectivity only rebuilds its cache when
+ * one of its parameters has changed
+ */
+TEST(Selectivities, Logistic_Reset_Only_Rebuilds_On_Change) {
+  MockModel model;
+  EXPECT_CALL(model, min_age()).WillRepeatedly(Return(10));
+  EXPECT_CALL(model, max_age()).WillRepeatedly(Return(20));
+  EXPECT_CALL(model, age_spread()).WillRepeatedly(Return(11));
+  EXPECT_CALL(model, partition_type()).WillRepeatedly(Return(PartitionType::kAge));
+
+  niwa::selectivities::Logistic logistic(&model);
+
+  logistic.parameters().Add(PARAM_LABEL, "unit_test_logistic", __FILE__, __LINE__);
+  logistic.parameters().Add(PARAM_TYPE, "not needed in test", __FILE__, __LINE__);
+  logistic.parameters().Add(PARAM_A50,   "2",  __FILE__, __LINE__);
+  logistic.parameters().Add(PARAM_ATO95, "7",  __FILE__, __LINE__);
+  logistic.Validate();
+  logistic.Build();
+  logistic.set_estimated(true);
+
+  logistic.Reset();
+  EXPECT_EQ(1u, logistic.cache_rebuilds());
+  EXPECT_EQ(0u, logistic.cache_rebuilds_skipped());
+
+  logistic.Reset();
+  logistic.Reset();
+  EXPECT_EQ(1u, logistic.cache_rebuilds());
+  EXPECT_EQ(2u, logistic.cache_rebuilds_skipped());
+  EXPECT_DOUBLE_EQ(0.96659497164362229, logistic.GetAgeResult(10, nullptr));
+
+  *logistic.GetAddressable(PARAM_A50) = 12.0;
+  logistic.Reset();
+  EXPECT_EQ(2u, logistic.cache_rebuilds());
+  EXPECT_EQ(2u, logistic.cache_rebuilds_skipped());
+  EXPECT_DOUBLE_EQ(0.3012677368748649, logistic.GetAgeResult(10, nullptr));
+}
+
 }
 
 #endif /* ifdef TESTMODE */
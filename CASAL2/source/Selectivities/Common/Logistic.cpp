@@ -107,9 +107,6 @@ Double Logistic::GetLengthBasedResult(unsigned age, AgeLength* age_length, unsig
   Double mean = age_length->mean_length(time_step, age);
   string dist = age_length->distribution_label();
 
-  cout << "logistic: age: " << age << "; time_step: " << time_step << "; year: " << yearx << "; cv: " << cv <<
-      "; mean: " << mean << "; dist: " << dist << endl;
-
   if (dist == PARAM_NONE || n_quant_ <= 1) {
     // no distribution_label just use the mu from age_length
     Double threshold = (a50_ - (Double) mean) / ato95_;
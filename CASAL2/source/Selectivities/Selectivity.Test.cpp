@@ -0,0 +1,177 @@
+/**
+ * @file Selectivity.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "Selectivity.h"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <boost/algorithm/string/replace.hpp>
+
+#include "AgeLengths/AgeLength.h"
+#include "AgeLengths/Manager.h"
+#include "BaseClasses/Executor.h"
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "Selectivities/Manager.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+#include "TimeSteps/Manager.h"
+
+// namespaces
+namespace niwa {
+
+using niwa::testfixtures::InternalEmptyModel;
+
+/**
+ * Gives the tests access to the length based result without the table
+ */
+struct LengthBasedAccess : public Selectivity {
+  using Selectivity::GetLengthBasedResult;
+};
+
+/**
+ * Runs a test once at the end of the model years while the
+ * model is still executing, so the current time step is available
+ */
+class ExecuteAtEnd : public base::Executor {
+public:
+  explicit ExecuteAtEnd(std::function<void()> test) : test_(test) { }
+  void Reset() override final { }
+  void PreExecute() override final { }
+  void Execute() override final {
+    if (test_)
+      test_();
+    test_ = nullptr;
+  }
+
+private:
+  std::function<void()> test_;
+};
+
+/**
+ * The two sex model with a length based fishing selectivity
+ */
+static string length_based_two_sex_model() {
+  string configuration = testcases::test_cases_two_sex_model_population;
+  boost::replace_first(configuration, "names immature.male mature.male immature.female mature.female",
+      "names immature.male mature.male immature.female mature.female\nage_lengths VB VB VB VB");
+  boost::replace_first(configuration, "@selectivity FishingSel\ntype logistic", "@selectivity FishingSel\ntype logistic\nlength_based true");
+  configuration += R"(
+@age_length VB
+type von_bertalanffy
+by_length false
+time_step_proportions 0.0 0.5
+k 0.059
+t0 -0.491
+Linf 37.78
+cv_first 0.09483
+cv_last 0.04498
+distribution normal
+length_weight wgt
+
+@length_weight wgt
+type basic
+units tonnes
+a 8.0e-8
+b 2.75
+)";
+  return configuration;
+}
+
+/**
+ * Check the table returns the same values as evaluating the quantiles
+ * and is recalculated when the selectivity changes
+ */
+TEST_F(InternalEmptyModel, Selectivities_Length_Based_Table) {
+  AddConfigurationLine(length_based_two_sex_model(), __FILE__, 40);
+  LoadConfiguration();
+
+  bool tested = false;
+  ExecuteAtEnd test([&]() {
+    Selectivity* selectivity = model_->managers().selectivity()->GetSelectivity("FishingSel");
+    AgeLength* age_length = model_->managers().age_length()->FindAgeLength("VB");
+    ASSERT_NE(nullptr, selectivity);
+    ASSERT_NE(nullptr, age_length);
+
+    auto uncached = &LengthBasedAccess::GetLengthBasedResult;
+    unsigned year = model_->current_year();
+    int time_step = (int)model_->managers().time_step()->current_time_step();
+    for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age) {
+      EXPECT_DOUBLE_EQ(AS_DOUBLE((selectivity->*uncached)(age, age_length, year, time_step)), AS_DOUBLE(selectivity->GetAgeResult(age, age_length))) << " with age = " << age;
+      EXPECT_DOUBLE_EQ(AS_DOUBLE((selectivity->*uncached)(age, age_length, year, time_step)), AS_DOUBLE(selectivity->GetAgeResult(age, age_length))) << " with age = " << age;
+    }
+
+    Double old_value = selectivity->GetAgeResult(10, age_length);
+    *selectivity->GetAddressable(PARAM_A50) = 12.0;
+    selectivity->AddressablesChanged();
+    EXPECT_DOUBLE_EQ(AS_DOUBLE((selectivity->*uncached)(10, age_length, year, time_step)), AS_DOUBLE(selectivity->GetAgeResult(10, age_length)));
+    EXPECT_GT(AS_DOUBLE(old_value), AS_DOUBLE(selectivity->GetAgeResult(10, age_length)));
+    tested = true;
+  });
+  model_->Subscribe(State::kExecute, &test);
+
+  model_->Start(RunMode::kBasic);
+  EXPECT_TRUE(tested);
+}
+
+/**
+ * Micro-benchmark of the length based selectivity. Reports the average
+ * time taken to get every age from the table and from the quantiles.
+ */
+TEST_F(InternalEmptyModel, Selectivities_Length_Based_Table_Benchmark) {
+  AddConfigurationLine(length_based_two_sex_model(), __FILE__, 40);
+  LoadConfiguration();
+
+  bool tested = false;
+  ExecuteAtEnd test([&]() {
+    Selectivity* selectivity = model_->managers().selectivity()->GetSelectivity("FishingSel");
+    AgeLength* age_length = model_->managers().age_length()->FindAgeLength("VB");
+    ASSERT_NE(nullptr, selectivity);
+    ASSERT_NE(nullptr, age_length);
+
+    auto uncached = &LengthBasedAccess::GetLengthBasedResult;
+    unsigned year = model_->current_year();
+    int time_step = (int)model_->managers().time_step()->current_time_step();
+    const unsigned iterations = 1000;
+
+    Double uncached_total = 0.0;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+      for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age)
+        uncached_total += (selectivity->*uncached)(age, age_length, year, time_step);
+    }
+    auto uncached_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    Double table_total = 0.0;
+    start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; ++i) {
+      for (unsigned age = model_->min_age(); age <= model_->max_age(); ++age)
+        table_total += selectivity->GetAgeResult(age, age_length);
+    }
+    auto table_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "[ BENCHMARK] length based selectivity quantiles: " << uncached_elapsed << " us for " << iterations << " passes over the ages" << std::endl;
+    std::cout << "[ BENCHMARK] length based selectivity table: " << table_elapsed << " us for " << iterations << " passes over the ages" << std::endl;
+    RecordProperty("quantile_microseconds", (int)uncached_elapsed);
+    RecordProperty("table_microseconds", (int)table_elapsed);
+    EXPECT_NEAR(AS_DOUBLE(uncached_total), AS_DOUBLE(table_total), 1e-9 * AS_DOUBLE(uncached_total));
+    tested = true;
+  });
+  model_->Subscribe(State::kExecute, &test);
+
+  model_->Start(RunMode::kBasic);
+  EXPECT_TRUE(tested);
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -78,11 +78,16 @@ void Selectivity::Validate() {
 
 
 /**
- *
+ * Rebuild the cache if one of our estimated parameters has
+ * changed since the last reset
  */
 void Selectivity::Reset() {
   if (is_estimated_) {
-    RebuildCache();
+    if (AddressablesChanged()) {
+      RebuildCache();
+      ++cache_rebuilds_;
+    } else
+      ++cache_rebuilds_skipped_;
   }
 }
 
@@ -104,7 +109,63 @@ Double Selectivity::GetAgeResult(unsigned age, AgeLength* age_length) {
     return values_[age - age_index_];
   }
 
-  return GetLengthBasedResult(age, age_length);
+  return GetLengthBasedTableResult(age, age_length);
+}
+
+/**
+ * Return the length based result for an age from the table held for
+ * the age length. The processes and observations ask for the same
+ * ages many times each year so the quantiles over the age length
+ * distribution are only evaluated once per year and time step.
+ *
+ * Years outside of the model and the initialisation phases
+ * share a row of the table.
+ *
+ * @param age The age to get the selectivity value for
+ * @param age_length The age length of the category
+ * @return The selectivity value
+ */
+Double Selectivity::GetLengthBasedTableResult(unsigned age, AgeLength* age_length) {
+  unsigned year = model_->current_year();
+  unsigned time_step = model_->managers().time_step()->current_time_step();
+  unsigned time_step_count = model_->managers().time_step()->size();
+  unsigned age_spread = model_->age_spread();
+  if (age_length == nullptr || age < age_index_ || age - age_index_ >= age_spread || time_step >= time_step_count || year < model_->start_year())
+    return GetLengthBasedResult(age, age_length);
+
+  LengthBasedTable* table = nullptr;
+  for (LengthBasedTable& existing : length_based_tables_) {
+    if (existing.age_length_ == age_length) {
+      table = &existing;
+      break;
+    }
+  }
+  if (table == nullptr) {
+    length_based_tables_.emplace_back();
+    table = &length_based_tables_.back();
+    table->age_length_ = age_length;
+    table->selectivity_version_ = addressable_version_;
+    table->age_length_version_ = age_length->addressable_version();
+  }
+
+  if (table->selectivity_version_ != addressable_version_ || table->age_length_version_ != age_length->addressable_version()) {
+    std::fill(table->filled_.begin(), table->filled_.end(), 0);
+    table->selectivity_version_ = addressable_version_;
+    table->age_length_version_ = age_length->addressable_version();
+  }
+
+  unsigned row = model_->state() == State::kInitialise ? 0 : year - model_->start_year() + 1;
+  unsigned index = (row * time_step_count + time_step) * age_spread + (age - age_index_);
+  if (index >= table->values_.size()) {
+    table->values_.resize((row + 1) * time_step_count * age_spread, 0.0);
+    table->filled_.resize(table->values_.size(), 0);
+  }
+
+  if (!table->filled_[index]) {
+    table->values_[index] = GetLengthBasedResult(age, age_length);
+    table->filled_[index] = 1;
+  }
+  return table->values_[index];
 }
 
 /**
@@ -48,6 +48,8 @@ protected:
   // pure methods
   virtual Double              GetLengthBasedResult(unsigned age, AgeLength* age_length, unsigned year = 0, int time_step_index = -1) = 0;
   virtual void                DoValidate() = 0;
+  // methods
+  Double                      GetLengthBasedTableResult(unsigned age, AgeLength* age_length);
   // Members
   Model*                      model_ = nullptr;
   unsigned                    n_quant_ = 5;
@@ -61,6 +63,21 @@ protected:
   PartitionType               partition_type_ = PartitionType::kInvalid;
   unsigned                    age_index_;
   map<string, Vector3>        cached_age_length_values_; // map<age_length_label, cache(year x time_step x age)>
+
+private:
+  /**
+   * Length based results for one age length. Each value is calculated the first
+   * time it is needed and the table is emptied when the addressables of either
+   * this selectivity or the age length change.
+   */
+  struct LengthBasedTable {
+    AgeLength*                age_length_ = nullptr;
+    unsigned                  selectivity_version_ = 0;
+    unsigned                  age_length_version_ = 0;
+    vector<Double>            values_; // [year row][time_step][age]; row 0 is the initialisation
+    vector<char>              filled_;
+  };
+  vector<LengthBasedTable>    length_based_tables_;
 };
 } /* namespace niwa */
 #endif /* SELECTIVITY_H_ */
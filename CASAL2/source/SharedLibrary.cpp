@@ -180,7 +180,7 @@ int Run(int argc, char * argv[], niwa::utilities::RunParameters& options) {
 
       // override any config file values from our command line
       model.global_configuration().ParseOptions(&model);
-      utilities::RandomNumberGenerator::Instance().Reset(model.global_configuration().random_seed());
+      model.random_number_generator().Reset(model.global_configuration().random_seed());
 
       // Thread off the reports
       reports::Manager* report_manager = model.managers().report();
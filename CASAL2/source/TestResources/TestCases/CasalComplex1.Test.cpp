@@ -11,10 +11,17 @@
 
 #include "CasalComplex1.h"
 
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <thread>
+
+#include "Model/Managers.h"
 #include "Model/Model.h"
 #include "ObjectiveFunction/ObjectiveFunction.h"
 #include "Observations/Manager.h"
 #include "Observations/Observation.h"
+#include "Reports/Manager.h"
 #include "TestResources/TestFixtures/InternalEmptyModel.h"
 
 // Namespaces
@@ -90,6 +97,64 @@ TEST_F(InternalEmptyModel, Model_CasalComplex1_Simulation) {
   EXPECT_DOUBLE_EQ(0.056026019079491715,  comparisons[1992][9].observed_);
 }
 
+/**
+ * Run the model with its reports written by a writer thread like main() does
+ */
+void StartWithReports(Model* model, RunMode::Type run_mode) {
+  reports::Manager* report_manager = model->managers().report();
+  std::thread report_thread([report_manager]() { report_manager->FlushReports(); });
+  model->Start(run_mode);
+  report_manager->StopThread();
+  report_thread.join();
+}
+
+/**
+ * Read and remove the simulated observation files for each candidate
+ */
+vector<string> TakeSimulatedFiles(unsigned candidates) {
+  vector<string> result;
+  for (unsigned i = 1; i <= candidates; ++i) {
+    string file_name = "simulated_tan.out." + std::to_string(i);
+    std::ifstream file(file_name.c_str());
+    std::stringstream contents;
+    contents << file.rdbuf();
+    result.push_back(contents.str());
+    file.close();
+    std::remove(file_name.c_str());
+  }
+  return result;
+}
+
+/**
+ * The simulated observations must be the same no matter how many threads are used
+ */
+TEST_F(InternalEmptyModel, Model_CasalComplex1_Simulation_Threads) {
+  AddConfigurationLine(test_cases_casal_complex_1, "CasalComplex1.h", 31);
+  AddConfigurationLine("@report simulated_tan\ntype simulated_observation\nobservation chatTANage\nfile_name simulated_tan.out", __FILE__, 164);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.simulation_candidates_ = 5;
+  parameters.threads_               = 1;
+  model_->global_configuration().set_run_parameters(parameters);
+  std::unique_ptr<Model> threaded_model = model_->CreateWorker(parameters);
+
+  StartWithReports(model_, RunMode::kSimulation);
+  vector<string> serial = TakeSimulatedFiles(5);
+
+  parameters.threads_ = 3;
+  threaded_model->global_configuration().set_run_parameters(parameters);
+  StartWithReports(threaded_model.get(), RunMode::kSimulation);
+  vector<string> threaded = TakeSimulatedFiles(5);
+
+  ASSERT_EQ(serial.size(), threaded.size());
+  for (unsigned i = 0; i < serial.size(); ++i) {
+    EXPECT_NE("", serial[i]);
+    EXPECT_EQ(serial[i], threaded[i]) << " for candidate " << i + 1;
+  }
+  EXPECT_NE(serial[0], serial[1]);
+}
+
 } /* namespace testcases */
 } /* namespace niwa */
 
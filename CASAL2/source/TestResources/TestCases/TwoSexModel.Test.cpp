@@ -14,9 +14,23 @@
 
 #include "TwoSexModel.h"
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <thread>
+
 #include "DerivedQuantities/Manager.h"
+#include "Estimates/Manager.h"
+#include "GlobalConfiguration/GlobalConfiguration.h"
+#include "Likelihoods/Common/Multinomial.h"
+#include "Minimisers/Manager.h"
+#include "Minimisers/Minimiser.h"
 #include "Model/Model.h"
 #include "ObjectiveFunction/ObjectiveFunction.h"
+#include "Observations/Manager.h"
+#include "Reports/Manager.h"
 #include "TestResources/TestFixtures/InternalEmptyModel.h"
 
 // Namespaces
@@ -53,6 +67,303 @@ TEST_F(InternalEmptyModel, Model_TwoSex_Estimation) {
   EXPECT_DOUBLE_EQ(1993.8041773625964, obj_function.score());
 }
 
+/**
+ * Points the minimiser has already evaluated are taken from the objective
+ * function cache. The estimation must give the same result as without it.
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Estimation_Objective_Cache) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  std::unique_ptr<Model> uncached_model = model_->CreateWorker(model_->global_configuration().run_parameters());
+  for (auto minimiser : uncached_model->managers().minimiser()->objects())
+    minimiser->parameters().Add(PARAM_OBJECTIVE_CACHE_SIZE, "0", __FILE__, __LINE__);
+
+  model_->Start(RunMode::kEstimation);
+  uncached_model->Start(RunMode::kEstimation);
+
+  ObjectiveFunction& objective = model_->objective_function();
+  ObjectiveFunction& uncached_objective = uncached_model->objective_function();
+  EXPECT_EQ(AS_DOUBLE(uncached_objective.score()), AS_DOUBLE(objective.score()));
+  vector<Estimate*> estimates = model_->managers().estimate()->objects();
+  vector<Estimate*> uncached_estimates = uncached_model->managers().estimate()->objects();
+  ASSERT_EQ(uncached_estimates.size(), estimates.size());
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    EXPECT_EQ(AS_DOUBLE(uncached_estimates[i]->value()), AS_DOUBLE(estimates[i]->value())) << estimates[i]->parameter();
+
+  EXPECT_EQ(64u, objective.cache_size());
+  EXPECT_LT(0u, objective.cache_hits());
+  EXPECT_EQ(0u, uncached_objective.cache_hits());
+  EXPECT_EQ(0u, uncached_objective.cache_misses());
+}
+
+/**
+ * Time the multinomial scores for the CAA_year comparisons when the data
+ * terms are kept between evaluations against the first call on a new likelihood
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Multinomial_Benchmark) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  Observation* observation = model_->managers().observation()->GetObservation("CAA_year");
+  ASSERT_NE(nullptr, observation);
+  map<unsigned, vector<obs::Comparison>> cached_comparisons = observation->comparisons();
+  map<unsigned, vector<obs::Comparison>> new_comparisons = cached_comparisons;
+
+  const unsigned evaluations = 200;
+  vector<std::unique_ptr<likelihoods::Multinomial>> new_likelihoods;
+  for (unsigned i = 0; i < evaluations; ++i)
+    new_likelihoods.emplace_back(new likelihoods::Multinomial(model_));
+  likelihoods::Multinomial cached_likelihood(model_);
+  cached_likelihood.GetScores(cached_comparisons);
+
+  auto start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < evaluations; ++i)
+    new_likelihoods[i]->GetScores(new_comparisons);
+  auto new_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  start = std::chrono::steady_clock::now();
+  for (unsigned i = 0; i < evaluations; ++i)
+    cached_likelihood.GetScores(cached_comparisons);
+  auto cached_elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+  cout << "[ BENCHMARK] multinomial CAA_year: " << new_elapsed / evaluations << " us per evaluation without cached data terms, "
+      << cached_elapsed / evaluations << " us with" << endl;
+  RecordProperty("microseconds_per_evaluation_new", (int)(new_elapsed / evaluations));
+  RecordProperty("microseconds_per_evaluation_cached", (int)(cached_elapsed / evaluations));
+
+  for (auto& iter : cached_comparisons) {
+    for (unsigned i = 0; i < iter.second.size(); ++i)
+      EXPECT_EQ(AS_DOUBLE(new_comparisons[iter.first][i].score_), AS_DOUBLE(iter.second[i].score_)) << "year " << iter.first << " i = " << i;
+  }
+}
+
+/**
+ * The numerical differences gradient must be the same no matter how many threads are used
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Estimation_Threads) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.threads_ = 1;
+  model_->global_configuration().set_run_parameters(parameters);
+  parameters.threads_ = 3;
+  std::unique_ptr<Model> threaded_model = model_->CreateWorker(parameters);
+
+  model_->Start(RunMode::kEstimation);
+  threaded_model->Start(RunMode::kEstimation);
+
+  EXPECT_EQ(model_->objective_function().score(), threaded_model->objective_function().score());
+  vector<Estimate*> estimates = model_->managers().estimate()->objects();
+  vector<Estimate*> threaded_estimates = threaded_model->managers().estimate()->objects();
+  ASSERT_EQ(estimates.size(), threaded_estimates.size());
+  for (unsigned i = 0; i < estimates.size(); ++i)
+    EXPECT_EQ(estimates[i]->value(), threaded_estimates[i]->value()) << estimates[i]->parameter();
+}
+
+/**
+ * Estimating from several starting points must keep the result of every start
+ * and finish on the best converged one
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Estimation_Multi_Start) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.estimation_starts_ = 4;
+  parameters.threads_ = 2;
+  model_->global_configuration().set_run_parameters(parameters);
+  model_->Start(RunMode::kEstimation);
+
+  auto minimiser = model_->managers().minimiser()->active_minimiser();
+  const vector<minimiser::StartResult>& results = minimiser->start_results();
+  ASSERT_EQ(4u, results.size());
+  EXPECT_EQ(model_->managers().estimate()->objects().size(), minimiser->start_parameters().size());
+
+  // the first start is the single start estimation
+  EXPECT_NEAR(1993.80, AS_DOUBLE(results[0].score_), 0.01);
+
+  unsigned best_count = 0;
+  for (unsigned i = 0; i < results.size(); ++i) {
+    EXPECT_EQ(i, results[i].start_);
+    EXPECT_EQ(minimiser->start_parameters().size(), results[i].values_.size());
+    if (!results[i].best_)
+      continue;
+    ++best_count;
+    EXPECT_TRUE(results[i].converged_);
+    EXPECT_EQ(1u, results[i].optimum_);
+    EXPECT_LE(AS_DOUBLE(results[i].score_), AS_DOUBLE(results[0].score_));
+    EXPECT_LE(AS_DOUBLE(model_->objective_function().score()), AS_DOUBLE(results[i].score_) + 1e-6);
+  }
+  EXPECT_EQ(1u, best_count);
+}
+
+/**
+ * Profile the a50 of the fishing selectivity and write the objective function
+ * and the fishing selectivity after each step
+ */
+const string two_sex_model_profile =
+R"(
+@profile a50
+parameter selectivity[FishingSel].a50
+lower_bound 4
+upper_bound 12
+steps 4
+
+@report profile_objective
+type objective_function
+file_name profile_objective.out
+
+@report profile_selectivity
+type selectivity
+selectivity FishingSel
+file_name profile_selectivity.out
+)";
+
+/**
+ * Run the profile with a report writer and read the total score and
+ * the profiled a50 after each step from the reports
+ */
+void RunProfile(Model* model, vector<double>& scores, vector<double>& a50s) {
+  reports::Manager* report_manager = model->managers().report();
+  std::thread report_thread([report_manager]() { report_manager->FlushReports(); });
+  model->Start(RunMode::kProfiling);
+  report_manager->StopThread();
+  report_thread.join();
+
+  std::ifstream objective_file("profile_objective.out");
+  string word;
+  while (objective_file >> word) {
+    double score = 0.0;
+    if (word == PARAM_TOTAL_SCORE && objective_file >> score)
+      scores.push_back(score);
+  }
+  objective_file.close();
+  std::remove("profile_objective.out");
+
+  std::ifstream selectivity_file("profile_selectivity.out");
+  while (selectivity_file >> word) {
+    double a50 = 0.0;
+    if (word == "a50:" && selectivity_file >> a50)
+      a50s.push_back(a50);
+  }
+  selectivity_file.close();
+  std::remove("profile_selectivity.out");
+}
+
+/**
+ * The profile points run on worker models must be reported in step order.
+ * Only the first step starts from the same values no matter how many threads are used,
+ * the later steps start from the nearest step that has finished
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Profiling_Threads) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  AddConfigurationLine(two_sex_model_profile, __FILE__, 201);
+  LoadConfiguration();
+
+  utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+  parameters.threads_ = 1;
+  model_->global_configuration().set_run_parameters(parameters);
+  parameters.threads_ = 3;
+  std::unique_ptr<Model> threaded_model = model_->CreateWorker(parameters);
+
+  vector<double> serial_scores, serial_a50s;
+  vector<double> threaded_scores, threaded_a50s;
+  RunProfile(model_, serial_scores, serial_a50s);
+  RunProfile(threaded_model.get(), threaded_scores, threaded_a50s);
+
+  vector<double> expected_a50s = { 4.0, 5.6, 7.2, 8.8, 10.4, 12.0 };
+  ASSERT_EQ(expected_a50s.size(), serial_scores.size());
+  ASSERT_EQ(expected_a50s.size(), threaded_scores.size());
+  ASSERT_EQ(expected_a50s.size(), serial_a50s.size());
+  ASSERT_EQ(expected_a50s.size(), threaded_a50s.size());
+  for (unsigned i = 0; i < expected_a50s.size(); ++i) {
+    EXPECT_NEAR(expected_a50s[i], serial_a50s[i], 1e-6) << "step " << i + 1;
+    EXPECT_NEAR(expected_a50s[i], threaded_a50s[i], 1e-6) << "step " << i + 1;
+  }
+  EXPECT_DOUBLE_EQ(serial_scores[0], threaded_scores[0]);
+}
+
+/**
+ * Reports written for each set of values in the -i file
+ */
+const string two_sex_model_input_value_reports =
+R"(
+@report input_derived_quantity
+type derived_quantity
+file_name input_derived_quantity.out
+
+@report input_selectivity
+type selectivity
+selectivity FishingSel
+file_name input_selectivity.out
+
+@report input_objective
+type objective_function
+file_name input_objective.out
+)";
+
+/**
+ * Do a basic run of each set of values in the -i file with a report writer
+ * and return the contents of the report files
+ */
+string RunInputValues(Model* model) {
+  reports::Manager* report_manager = model->managers().report();
+  std::thread report_thread([report_manager]() { report_manager->FlushReports(); });
+  model->Start(RunMode::kBasic);
+  report_manager->StopThread();
+  report_thread.join();
+
+  string result = "";
+  for (string file_name : { "input_derived_quantity.out", "input_selectivity.out", "input_objective.out" }) {
+    std::ifstream file(file_name);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    file.close();
+    std::remove(file_name.c_str());
+    result += contents.str();
+  }
+  return result;
+}
+
+/**
+ * The sets of values in the -i file run on worker models must be reported in
+ * row order, with one header for the tabular reports, the same as a single thread
+ */
+TEST_F(InternalEmptyModel, Model_TwoSex_Input_Values_Threads) {
+  AddConfigurationLine(test_cases_two_sex_model_population, __FILE__, 27);
+  AddConfigurationLine(two_sex_model_input_value_reports, __FILE__, 263);
+  LoadConfiguration();
+
+  std::ofstream input_file("input_values.out");
+  input_file << "selectivity[FishingSel].a50 process[Recruitment].R0\n";
+  for (unsigned i = 0; i < 9; ++i)
+    input_file << 5.0 + i * 0.75 << " " << 900000 + i * 25000 << "\n";
+  input_file.close();
+
+  for (bool tabular : { false, true }) {
+    std::unique_ptr<Model> serial_model;
+    std::unique_ptr<Model> threaded_model;
+    utilities::RunParameters parameters = model_->global_configuration().run_parameters();
+    parameters.estimable_value_input_file_ = "input_values.out";
+    parameters.tabular_reports_ = tabular;
+    parameters.threads_ = 1;
+    serial_model = model_->CreateWorker(parameters);
+    parameters.threads_ = 3;
+    threaded_model = model_->CreateWorker(parameters);
+
+    string serial_output = RunInputValues(serial_model.get());
+    string threaded_output = RunInputValues(threaded_model.get());
+    EXPECT_NE("", serial_output);
+    EXPECT_EQ(serial_output, threaded_output) << "tabular " << tabular;
+    EXPECT_DOUBLE_EQ(AS_DOUBLE(serial_model->objective_function().score()), AS_DOUBLE(threaded_model->objective_function().score()));
+  }
+  std::remove("input_values.out");
+}
+
 /**
  *
  */
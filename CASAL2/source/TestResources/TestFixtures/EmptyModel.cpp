@@ -31,8 +31,7 @@ EmptyModel::~EmptyModel() {}
 void EmptyModel::SetUp() {
   Base::SetUp();
 
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-  rng.Reset(2468);
+  model_->random_number_generator().Reset(2468);
 }
 
 
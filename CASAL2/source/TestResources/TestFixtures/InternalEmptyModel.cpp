@@ -46,8 +46,7 @@ namespace testfixtures {
 void InternalEmptyModel::SetUp() {
   Base::SetUp();
 
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
-  rng.Reset(2468);
+  model_->random_number_generator().Reset(2468);
 
   configuration_file_.clear();
   model_->global_configuration().flag_skip_config_file();
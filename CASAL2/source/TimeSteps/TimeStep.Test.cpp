@@ -0,0 +1,81 @@
+/**
+ * @file TimeStep.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// Headers
+#include "TimeStep.h"
+
+#include "Model/Managers.h"
+#include "Model/Model.h"
+#include "ObjectiveFunction/ObjectiveFunction.h"
+#include "TestResources/TestCases/TwoSexModel.h"
+#include "TestResources/TestFixtures/InternalEmptyModel.h"
+#include "TimeSteps/Manager.h"
+
+// Namespaces
+namespace niwa {
+
+using niwa::testfixtures::InternalEmptyModel;
+using niwa::testcases::test_cases_two_sex_model_population;
+
+const std::string test_cases_time_step_execution_plan =
+R"(
+@report plan
+type execution_plan
+)";
+
+/**
+ * Check the compiled plan runs the processes in order with the
+ * observation hooks only in the observation years, and that the
+ * execution plan report profiles each process
+ */
+TEST_F(InternalEmptyModel, TimeStep_Compiled_Plan) {
+  AddConfigurationLine(test_cases_two_sex_model_population, "TwoSexModel.h", 27);
+  AddConfigurationLine(test_cases_time_step_execution_plan, __FILE__, 28);
+  LoadConfiguration();
+
+  model_->Start(RunMode::kBasic);
+
+  ObjectiveFunction& obj_function = model_->objective_function();
+  EXPECT_DOUBLE_EQ(2698.1334330594036, obj_function.score());
+
+  TimeStep* step_one = model_->managers().time_step()->GetTimeStep("step_one");
+  ASSERT_NE(nullptr, step_one);
+
+  vector<string> process_labels;
+  for (auto& entry : step_one->plan(2000)) {
+    if (entry.type_ == TimeStep::PlanEntry::Type::kProcess)
+      process_labels.push_back(entry.process_->label());
+  }
+  vector<string> expected_labels = { "Recruitment", "maturation", "halfM", "Fishing", "halfM" };
+  EXPECT_EQ(expected_labels, process_labels);
+
+  // the abundance derived quantity runs every year but the observations
+  // only start in 1998 so they add a pre-execute and execute pair each
+  EXPECT_EQ(7u, step_one->plan(1995).size());
+  EXPECT_EQ(11u, step_one->plan(2000).size());
+
+  unsigned recruitment_calls = 0;
+  unsigned half_m_calls = 0;
+  for (auto& profile : step_one->plan_profile()) {
+    if (profile.type_ != PARAM_PROCESS)
+      continue;
+    if (profile.label_ == "Recruitment")
+      recruitment_calls = profile.calls_;
+    else if (profile.label_ == "halfM")
+      half_m_calls = profile.calls_;
+    EXPECT_LE(0.0, profile.seconds_);
+  }
+  EXPECT_LE(15u, recruitment_calls);
+  EXPECT_EQ(recruitment_calls * 2, half_m_calls);
+}
+
+} /* namespace niwa */
+#endif /* TESTMODE */
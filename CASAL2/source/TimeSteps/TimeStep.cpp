@@ -12,6 +12,7 @@
 
 #include "TimeStep.h"
 
+#include <chrono>
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/split.hpp>
 
@@ -74,6 +75,7 @@ void TimeStep::Build() {
   }
 
   mortality_block_.second = mortality_block_.first == processes_.size() ? mortality_block_.first : mortality_block_.second;
+  plan_compiled_ = false;
 }
 
 /**
@@ -81,30 +83,13 @@ void TimeStep::Build() {
  */
 void TimeStep::ExecuteForInitialisation(const string& phase_label) {
   LOG_FINEST() << "Executing for initialisation phase: " << phase_label << " with " << initialisation_block_executors_.size() << " executors";
-  LOG_FINEST() << "initialisation_processes_[phase_label].size(): " << initialisation_processes_[phase_label].size();
-  for (unsigned index = 0; index < initialisation_processes_[phase_label].size(); ++index) {
-    if (initialisation_mortality_blocks_[phase_label].first == index) {
-      for (auto executor : initialisation_block_executors_) {
-        LOG_FINEST() << "Executing executor: " << executor->label();
-        executor->PreExecute();
-      }
-    }
-
-    initialisation_processes_[phase_label][index]->Execute(0u, "");
-
-    if (initialisation_mortality_blocks_[phase_label].second == index) {
-      for (auto executor : initialisation_block_executors_) {
-        executor->Execute();
-      }
-    }
+  auto iter = initialisation_plans_.find(phase_label);
+  if (iter == initialisation_plans_.end()) {
+    CompileInitialisationPlan(phase_label);
+    iter = initialisation_plans_.find(phase_label);
   }
 
-  if (initialisation_mortality_blocks_[phase_label].first == processes_.size()) {
-     for (auto executor : initialisation_block_executors_) {
-       executor->PreExecute();
-       executor->Execute();
-     }
-  }
+  ExecutePlan(iter->second, 0u, "");
 }
 
 /**
@@ -112,39 +97,205 @@ void TimeStep::ExecuteForInitialisation(const string& phase_label) {
  */
 void TimeStep::Execute(unsigned year) {
   LOG_TRACE();
+  if (!plan_compiled_ || year < plan_first_year_ || year - plan_first_year_ >= plan_.size())
+    CompilePlan(year);
 
-  for (auto executor : executors_[year])
-      executor->PreExecute();
+  ExecutePlan(plan_[year - plan_first_year_], year, label_);
+}
 
-  for (unsigned index = 0; index < processes_.size(); ++index) {
-    if (index == mortality_block_.first) {
-      for (auto executor : block_executors_[year])
-        executor->PreExecute();
-    }
+/**
+ * Run each entry of a compiled plan. When profiling is turned on
+ * the time spent in each entry is added to its profile.
+ *
+ * @param plan The plan to run
+ * @param year The year passed to the processes
+ * @param time_step_label The time step label passed to the processes
+ */
+void TimeStep::ExecutePlan(const vector<PlanEntry>& plan, unsigned year, const string& time_step_label) {
+  if (!profile_plan_) {
+    for (const PlanEntry& entry : plan)
+      ExecutePlanEntry(entry, year, time_step_label);
+    return;
+  }
+
+  for (const PlanEntry& entry : plan) {
+    auto start = std::chrono::steady_clock::now();
+    ExecutePlanEntry(entry, year, time_step_label);
+    PlanProfile& profile = plan_profile_[entry.profile_index_];
+    profile.seconds_ += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    ++profile.calls_;
+  }
+}
+
+/**
+ * Run a single entry of a compiled plan
+ */
+void TimeStep::ExecutePlanEntry(const PlanEntry& entry, unsigned year, const string& time_step_label) {
+  switch (entry.type_) {
+  case PlanEntry::Type::kProcess:
+    LOG_FINEST() << "Executing process: " << entry.process_->label();
+    entry.process_->Execute(year, time_step_label);
+    break;
+  case PlanEntry::Type::kPreExecute: {
+    Timings::Timer timer(model_->timings(), entry.executor_, nullptr, Timings::Method::kPreExecute);
+    entry.executor_->PreExecute();
+    break;
+  }
+  case PlanEntry::Type::kExecute: {
+    Timings::Timer timer(model_->timings(), entry.executor_, nullptr, Timings::Method::kExecute);
+    entry.executor_->Execute();
+    break;
+  }
+  }
+}
 
-    for(auto executor : process_executors_[year][index])
-      executor->PreExecute();
+/**
+ * Compile the plan for every year the model can run. The plan for
+ * each year holds the calls Execute() makes in the order they are made:
+ *
+ * 1. PreExecute() for the executors subscribed to the year
+ * 2. For each process:
+ *  - PreExecute() for the mortality block executors at the start of the block
+ *  - PreExecute() for the executors subscribed to the process
+ *  - The process
+ *  - Execute() for the executors subscribed to the process
+ *  - Execute() for the mortality block executors at the end of the block
+ * 3. PreExecute() and Execute() for the mortality block executors if there is no block
+ * 4. Execute() for the executors subscribed to the year
+ *
+ * @param year A year that has to be in the plan
+ */
+void TimeStep::CompilePlan(unsigned year) {
+  LOG_TRACE();
+  unsigned first_year = std::min(model_->start_year(), year);
+  unsigned final_year = std::max(std::max(model_->final_year(), model_->projection_final_year()), year);
+
+  plan_first_year_ = first_year;
+  plan_.assign(final_year - first_year + 1, vector<PlanEntry>());
+  vector<Executor*> no_executors;
+  for (unsigned plan_year = first_year; plan_year <= final_year; ++plan_year) {
+    vector<PlanEntry>& plan = plan_[plan_year - first_year];
+    auto executors_iter = executors_.find(plan_year);
+    const vector<Executor*>& executors = executors_iter == executors_.end() ? no_executors : executors_iter->second;
+    auto block_iter = block_executors_.find(plan_year);
+    const vector<Executor*>& block_executors = block_iter == block_executors_.end() ? no_executors : block_iter->second;
+    auto process_iter = process_executors_.find(plan_year);
+
+    auto add_executors = [&](const vector<Executor*>& hooks, PlanEntry::Type type) {
+      for (auto executor : hooks) {
+        PlanEntry entry;
+        entry.type_           = type;
+        entry.executor_       = executor;
+        entry.profile_index_  = PlanProfileIndex(type, nullptr, executor);
+        plan.push_back(entry);
+      }
+    };
+
+    add_executors(executors, PlanEntry::Type::kPreExecute);
+    for (unsigned index = 0; index < processes_.size(); ++index) {
+      const vector<Executor*>* process_executors = &no_executors;
+      if (process_iter != process_executors_.end() && process_iter->second.find(index) != process_iter->second.end())
+        process_executors = &process_iter->second.find(index)->second;
+
+      if (index == mortality_block_.first)
+        add_executors(block_executors, PlanEntry::Type::kPreExecute);
+      add_executors(*process_executors, PlanEntry::Type::kPreExecute);
+
+      PlanEntry entry;
+      entry.process_        = processes_[index];
+      entry.profile_index_  = PlanProfileIndex(PlanEntry::Type::kProcess, processes_[index], nullptr);
+      plan.push_back(entry);
+
+      add_executors(*process_executors, PlanEntry::Type::kExecute);
+      if (index == mortality_block_.second)
+        add_executors(block_executors, PlanEntry::Type::kExecute);
+    }
 
-    LOG_FINEST() << "Executing process: " << processes_[index]->label();
-    processes_[index]->Execute(year, label_);
+    if (mortality_block_.first == processes_.size()) {
+      for (auto executor : block_executors) {
+        add_executors({ executor }, PlanEntry::Type::kPreExecute);
+        add_executors({ executor }, PlanEntry::Type::kExecute);
+      }
+    }
+    add_executors(executors, PlanEntry::Type::kExecute);
+  }
 
-    for(auto executor : process_executors_[year][index])
-      executor->Execute();
+  plan_compiled_ = true;
+}
 
-    if (index == mortality_block_.second) {
-      for (auto executor : block_executors_[year])
-        executor->Execute();
+/**
+ * Compile the plan for an initialisation phase. This follows the same
+ * order as CompilePlan() using the initialisation processes and the
+ * executors subscribed to the initialisation block.
+ *
+ * @param phase_label The label of the initialisation phase
+ */
+void TimeStep::CompileInitialisationPlan(const string& phase_label) {
+  vector<PlanEntry>& plan = initialisation_plans_[phase_label];
+  const vector<Process*>& processes = initialisation_processes_[phase_label];
+  const pair<unsigned, unsigned>& mortality_block = initialisation_mortality_blocks_[phase_label];
+
+  auto add_executors = [&](PlanEntry::Type type) {
+    for (auto executor : initialisation_block_executors_) {
+      PlanEntry entry;
+      entry.type_           = type;
+      entry.executor_       = executor;
+      entry.profile_index_  = PlanProfileIndex(type, nullptr, executor);
+      plan.push_back(entry);
     }
+  };
+
+  for (unsigned index = 0; index < processes.size(); ++index) {
+    if (mortality_block.first == index)
+      add_executors(PlanEntry::Type::kPreExecute);
+
+    PlanEntry entry;
+    entry.process_        = processes[index];
+    entry.profile_index_  = PlanProfileIndex(PlanEntry::Type::kProcess, processes[index], nullptr);
+    plan.push_back(entry);
+
+    if (mortality_block.second == index)
+      add_executors(PlanEntry::Type::kExecute);
   }
-  if (mortality_block_.first == processes_.size()){
-    for (auto executor : block_executors_[year]) {
-      executor->PreExecute();
-      executor->Execute();
+
+  if (mortality_block.first == processes_.size()) {
+    for (auto executor : initialisation_block_executors_) {
+      PlanEntry entry;
+      entry.executor_       = executor;
+      entry.type_           = PlanEntry::Type::kPreExecute;
+      entry.profile_index_  = PlanProfileIndex(entry.type_, nullptr, executor);
+      plan.push_back(entry);
+      entry.type_           = PlanEntry::Type::kExecute;
+      entry.profile_index_  = PlanProfileIndex(entry.type_, nullptr, executor);
+      plan.push_back(entry);
     }
   }
+}
 
-  for (auto executor : executors_[year])
-    executor->Execute();
+/**
+ * Find the profile for a process or executor hook. Each process and
+ * executor hook shares one profile across all years of the plan.
+ *
+ * @return The index of the profile in plan_profile_
+ */
+unsigned TimeStep::PlanProfileIndex(PlanEntry::Type type, Process* process, Executor* executor) {
+  const void* object = process != nullptr ? (const void*)process : (const void*)executor;
+  auto key = std::make_pair((unsigned)type, object);
+  auto iter = plan_profile_indexes_.find(key);
+  if (iter != plan_profile_indexes_.end())
+    return iter->second;
+
+  PlanProfile profile;
+  if (type == PlanEntry::Type::kProcess) {
+    profile.label_ = process->label();
+    profile.type_  = PARAM_PROCESS;
+  } else {
+    profile.label_ = executor->label();
+    profile.type_  = type == PlanEntry::Type::kPreExecute ? "pre_execute" : "execute";
+  }
+  plan_profile_.push_back(profile);
+  plan_profile_indexes_[key] = plan_profile_.size() - 1;
+  return plan_profile_.size() - 1;
 }
 
 /**
@@ -154,6 +305,7 @@ void TimeStep::SubscribeToBlock(Executor* executor) {
   vector<unsigned> years = model_->years();
   for (unsigned year : years)
     block_executors_[year].push_back(executor);
+  plan_compiled_ = false;
 }
 
 /**
@@ -165,6 +317,7 @@ Process* TimeStep::SubscribeToProcess(Executor* executor, unsigned year, string
   for (unsigned i = 0; i < processes_.size(); ++i) {
     if (processes_[i]->label() == process_label) {
       process_executors_[year][i].push_back(executor);
+      plan_compiled_ = false;
       return processes_[i];
     }
   }
@@ -183,6 +336,7 @@ Process* TimeStep::SubscribeToProcess(Executor* executor, const vector<unsigned>
     if (processes_[i]->label() == process_label) {
       for (unsigned year : years)
         process_executors_[year][i].push_back(executor);
+      plan_compiled_ = false;
       return processes_[i];
     }
   }
@@ -196,6 +350,7 @@ Process* TimeStep::SubscribeToProcess(Executor* executor, const vector<unsigned>
  */
 void TimeStep::SetInitialisationProcessLabels(const string& initialisation_phase_label, vector<string> process_labels_) {
   initialisation_process_labels_[initialisation_phase_label] = process_labels_;
+  initialisation_plans_.clear();
 }
 
 /**
@@ -204,6 +359,7 @@ void TimeStep::SetInitialisationProcessLabels(const string& initialisation_phase
 void TimeStep::BuildInitialisationProcesses() {
   LOG_TRACE();
   initialisation_processes_.clear();
+  initialisation_plans_.clear();
 
   for (auto iter : initialisation_process_labels_) {
     for (string process_label : iter.second) {
@@ -11,6 +11,12 @@
  *
  * The time class represents a moment of time.
  *
+ * The processes and the executors subscribed to them are compiled in to
+ * a flat plan for each year (and each initialisation phase) the first
+ * time the time step is executed. Executing a year then walks the plan
+ * without looking anything up. Subscribing a new executor marks the plan
+ * so it is compiled again.
+ *
  * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
  */
 #ifndef TIMESTEP_H_
@@ -34,6 +40,27 @@ using base::Executor;
  */
 class TimeStep : public niwa::base::Object {
 public:
+  /**
+   * A single call in the compiled plan
+   */
+  struct PlanEntry {
+    enum class Type { kProcess, kPreExecute, kExecute };
+    Type                      type_ = Type::kProcess;
+    Process*                  process_ = nullptr;
+    Executor*                 executor_ = nullptr;
+    unsigned                  profile_index_ = 0;
+  };
+
+  /**
+   * Time spent in the plan entries for a process or an executor hook
+   */
+  struct PlanProfile {
+    string                    label_ = "";
+    string                    type_ = "";
+    unsigned                  calls_ = 0;
+    double                    seconds_ = 0.0;
+  };
+
   // Methods
   TimeStep() = delete;
   explicit TimeStep(Model* model);
@@ -44,21 +71,31 @@ public:
   void                        ExecuteForInitialisation(const string& phase_label);
   void                        Execute(unsigned year);
   bool                        HasProcess(const string& label) { return std::find(process_names_.begin(), process_names_.end(), label) != process_names_.end(); }
-  void                        Subscribe(Executor* executor, unsigned year) { executors_[year].push_back(executor); }
-  void                        SubscribeToInitialisationBlock(Executor* executor) { initialisation_block_executors_.push_back(executor); }
+  void                        Subscribe(Executor* executor, unsigned year) { executors_[year].push_back(executor); plan_compiled_ = false; }
+  void                        SubscribeToInitialisationBlock(Executor* executor) { initialisation_block_executors_.push_back(executor); initialisation_plans_.clear(); }
   void                        SubscribeToBlock(Executor* executor);
-  void                        SubscribeToBlock(Executor* executor, unsigned year) { block_executors_[year].push_back(executor); }
+  void                        SubscribeToBlock(Executor* executor, unsigned year) { block_executors_[year].push_back(executor); plan_compiled_ = false; }
   Process*                    SubscribeToProcess(Executor* executor, unsigned year, string process_label);
   Process*                    SubscribeToProcess(Executor* executor, const vector<unsigned>& years, string process_label);
   void                        SetInitialisationProcessLabels(const string& initialisation_phase_label, vector<string> process_labels_);
   void                        BuildInitialisationProcesses();
+  void                        CompilePlan(unsigned year);
 
   // accessors
   const vector<Process*>&     processes() const { return processes_; }
   vector<string>              process_labels() const { return process_names_; }
   vector<string>              initialisation_process_labels(const string& initialisation_phase) { return initialisation_process_labels_[initialisation_phase]; }
+  const vector<PlanEntry>&    plan(unsigned year) const { return plan_[year - plan_first_year_]; }
+  const vector<PlanProfile>&  plan_profile() const { return plan_profile_; }
+  void                        set_profile_plan(bool profile_plan) { profile_plan_ = profile_plan; }
 
 private:
+  // Methods
+  void                        CompileInitialisationPlan(const string& phase_label);
+  unsigned                    PlanProfileIndex(PlanEntry::Type type, Process* process, Executor* executor);
+  void                        ExecutePlan(const vector<PlanEntry>& plan, unsigned year, const string& time_step_label);
+  void                        ExecutePlanEntry(const PlanEntry& entry, unsigned year, const string& time_step_label);
+
   // Members
   Model*                              model_ = nullptr;
   vector<string>                      process_names_;
@@ -71,6 +108,13 @@ private:
   map<string, vector<Process*>>       initialisation_processes_;
   map<string, pair<unsigned, unsigned>> initialisation_mortality_blocks_;
   map<unsigned, map<unsigned, vector<Executor*>>> process_executors_; // year/process index
+  bool                                plan_compiled_ = false;
+  unsigned                            plan_first_year_ = 0;
+  vector<vector<PlanEntry>>           plan_; // year - plan_first_year_
+  map<string, vector<PlanEntry>>      initialisation_plans_;
+  bool                                profile_plan_ = false;
+  vector<PlanProfile>                 plan_profile_;
+  map<pair<unsigned, const void*>, unsigned> plan_profile_indexes_; // type/process or executor
 };
 } /* namespace niwa */
 #endif /* TIMESTEP_H_ */
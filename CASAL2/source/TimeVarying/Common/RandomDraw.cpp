@@ -65,7 +65,7 @@ void RandomDraw::DoBuild() {
  *
  */
 void RandomDraw::DoReset() {
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
   Double new_value = 0.0;
   // Draw from the random distribution
   if (distribution_ == PARAM_NORMAL) {
@@ -62,7 +62,7 @@ void RandomWalk::DoBuild() {
  */
 void RandomWalk::DoUpdate() {
   LOG_FINEST() << "value = " << *addressable_;
-  utilities::RandomNumberGenerator& rng = utilities::RandomNumberGenerator::Instance();
+  utilities::RandomNumberGenerator& rng = model_->random_number_generator();
   Double value = *addressable_;
   Double deviate = rng.normal(AS_DOUBLE(mu_), AS_DOUBLE(sigma_));
   value += value * rho_ + deviate;
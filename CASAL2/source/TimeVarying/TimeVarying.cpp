@@ -107,6 +107,8 @@ void TimeVarying::Update(unsigned current_year) {
 
   target_object_->RebuildCache();
   target_object_->NotifySubscribers();
+  // the cache now matches the current values
+  target_object_->AddressablesChanged();
 }
 
 /**
@@ -173,6 +173,8 @@
 #define PARAM_BOBYQA_STOPPING_TRUST_RADIUS        "bobyqa_stopping_trust_radius"
 #define PARAM_BY_LENGTH                           "by_length"
 #define PARAM_C                                   "c"
+#define PARAM_CACHE_REBUILDS                      "cache_rebuilds"
+#define PARAM_CALCULATE_SCORE                     "calculate_score"
 #define PARAM_CASAL_PENALTY                       "casal_penalty"
 #define PARAM_CASAL_INTIALISATION                 "casal_intialisation_switch"
 #define PARAM_CASAL_SWITCH                        "casal_switch"
@@ -192,6 +194,7 @@
 #define PARAM_CATEGORY_LABELS                     "category_labels"
 #define PARAM_CINITIAL                            "cinitial"
 #define PARAM_CELL_LENGTH                         "cell_length"
+#define PARAM_CENTRAL_DIFFERENCES                 "central_differences"
 #define PARAM_CLASS_MINIMUMS                      "class_minimums"
 #define PARAM_COLUMN                              "column"
 #define PARAM_COLUMN_INDEX                        "column_index"
@@ -268,6 +271,8 @@
 #define PARAM_EVENT                               "event"
 #define PARAM_EVENT_MORTALITY                     "event_mortality"
 #define PARAM_EXCLUDE_PROCESSES                   "exclude_processes"
+#define PARAM_EXECUTION_PLAN                      "execution_plan"
+#define PARAM_EXECUTE                             "execute"
 #define PARAM_EXPECTED_VALUE                      "expected_value"
 #define PARAM_EXPONENTIAL                         "exponential"
 #define PARAM_EXOGENOUS_VARIABLE                  "exogeneous_variable"
@@ -296,6 +301,7 @@
 #define PARAM_FROM                                "from"
 #define PARAM_FUNCTION                            "function"
 #define PARAM_GAMMADIFF                           "numerical_differences"
+#define PARAM_GRADIENT_STEP_SIZE                  "gradient_step_size"
 #define PARAM_GRAMS                               "grams"
 #define PARAM_GROWTH                              "growth"
 #define PARAM_GROWTH_BASED                        "growth_based"
@@ -303,6 +309,7 @@
 #define PARAM_GROWTH_PROPORTIONS                  "growth_proportions"
 #define PARAM_GROWTH_TIME_STEPS                   "growth_time_steps"
 #define PARAM_H                                   "h"
+#define PARAM_HAMILTONIAN_MONTE_CARLO             "hamiltonian_monte_carlo"
 #define PARAM_DOUBLE_HALF                         "double_half"
 #define PARAM_HEADER                              "header"
 #define PARAM_HEIGHT                              "height"
@@ -385,8 +392,10 @@
 #define PARAM_MAX_GENERATIONS                     "max_generations"
 #define PARAM_MAX_ITER                            "max_iter"
 #define PARAM_MAX_ITERATIONS                      "iterations"
+#define PARAM_MAX_TREE_DEPTH                      "max_tree_depth"
 #define PARAM_MCMC                                "mcmc"
 #define PARAM_MCMC_CHAIN                          "mcmc_chain"
+#define PARAM_MCMC_CONVERGENCE                    "mcmc_convergence"
 #define PARAM_MCMC_COVARIANCE                     "mcmc_covariance"
 #define PARAM_MCMC_FIXED                          "mcmc_fixed"
 #define PARAM_MCMC_OBJECTIVE                      "mcmc_objective"
@@ -421,6 +430,7 @@
 #define PARAM_MORTALITY_HOLLING_RATE              "mortality_holling_rate"
 #define PARAM_MPD                                 "mpd"
 #define PARAM_MU                                  "mu"
+#define PARAM_MULTI_START                         "multi_start"
 #define PARAM_MULTINOMIAL                         "multinomial"
 #define PARAM_MULTIPLICATIVE                      "multiplicative"
 #define PARAM_MULTIPLIER                          "multiplier"
@@ -438,8 +448,10 @@
 #define PARAM_NUISANCE                            "nuisance"
 #define PARAM_NUMBERS                             "numbers"
 #define PARAM_NUMBER_OF_GROWTH_EPISODES           "number_of_growth_episodes"
+#define PARAM_NUTS                                "nuts"
 #define PARAM_NROWS                               "nrows"
 #define PARAM_OBJECTIVE                           "objective"
+#define PARAM_OBJECTIVE_CACHE_SIZE                "objective_cache_size"
 #define PARAM_OBJECTIVE_FUNCTION                  "objective_function"
 #define PARAM_OBS                                 "obs"
 #define PARAM_OBSERVATION                         "observation"
@@ -472,6 +484,7 @@
 #define PARAM_PREFERENCE_MOVEMENT                 "preference"
 #define PARAM_PREFERENCE_FUNCTION                 "preference_function"
 #define PARAM_PREFERENCE_FUNCTIONS                "preference_functions"
+#define PARAM_PRE_EXECUTE                         "pre_execute"
 #define PARAM_PRINT_DEFAULT_REPORTS               "print_default_reports"
 #define PARAM_PRINT_LEVEL                         "print_level"
 #define PARAM_PRINT_REPORT                        "print_report"
@@ -588,6 +601,7 @@
 #define PARAM_STEPS                               "steps"
 #define PARAM_STEEPNESS                           "steepness"
 #define PARAM_STRING                              "categorical"
+#define PARAM_SYNCHRONOUS                         "synchronous"
 #define PARAM_SUM_TO_ONE                          "sum_to_one"
 #define PARAM_T                                   "t"
 #define PARAM_T0                                  "t0"
@@ -605,6 +619,7 @@
 #define PARAM_TAG_RECAPTURE_BY_LENGTH             "tag_recapture_by_length"
 #define PARAM_TAU1                                "tau1"
 #define PARAM_TAU2                                "tau2"
+#define PARAM_TARGET_ACCEPTANCE_RATE              "target_acceptance_rate"
 #define PARAM_TARGET_CATEGORIES                   "categories2"
 #define PARAM_TARGET_SELECTIVITIES                "selectivities2"
 #define PARAM_TERMINAL_YEAR                       "terminal_year"
@@ -620,6 +635,7 @@
 #define PARAM_TIME_STEP_RATIO                     "time_step_ratio"
 #define PARAM_TIME_STEPS                          "time_steps"
 #define PARAM_TIME_VARYING                        "time_varying"
+#define PARAM_TIMING                              "timing"
 #define PARAM_TO                                  "to"
 #define PARAM_TOL                                 "tol"
 #define PARAM_TOLERANCE                           "tolerance"
@@ -650,6 +666,7 @@
 #define PARAM_VALUE                               "value"
 #define PARAM_VALUES                              "values"
 #define PARAM_VERBOSE                             "verbose"
+#define PARAM_WARMUP                              "warmup"
 #define PARAM_WIDTH                               "width"
 #define PARAM_WEIGHTS                             "weights"
 #define PARAM_WEIGHTED_PRODUCT                    "weighted_product"
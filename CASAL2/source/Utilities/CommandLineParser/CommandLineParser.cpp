@@ -53,22 +53,26 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
     ("config,c", value<string>(), "Configuration file")
     ("run,r", "Basic model run mode")
     ("estimate,e", "Point estimation run mode")
+    ("starts", value<unsigned>(), "Number of jittered starting points to estimate from in parallel (default: 1)")
     ("mcmc,m", "Markov Chain Monte Carlo run mode (arg = continue, default: false)")
     ("skip-estimation", "Skip estimation before running the MCMC, load existing MPD")
     ("resume", "Resume the MCMC chain")
     ("objective-file", value<string>(), "Objective file for resuming an MCMC")
     ("sample-file", value<string>(), "Sample file for resuming an MCMC")
+    ("chains", value<unsigned>(), "Number of MCMC chains to run in parallel (default: 1)")
     ("profiling,p", "Profling run mode")
     ("simulation,s", value<unsigned>(), "Simulation mode (arg = number of candidates)")
     ("projection,f", value<unsigned>(), "Projection mode (arg = number of projections per set of input values)")
     ("input,i", value<string>(), "Load free parameter values from file")
     ("fi", "Force the input file to only allow @estimate parameters (basic run mode only)")
+    ("threads,t", value<unsigned>(), "Number of threads to use for parallel runs (default: number of cores)")
     ("seed,g", value<unsigned>(), "Random number seed")
     ("query,q", value<string>(), "Query an object type to see its description and parameters. Argument object_type.sub_type e.g. process.recruitment_constant")
     ("debug,d", "Run in debug mode (with debug output")
     ("nostd", "Do not print the standard header report")
     ("loglevel", value<string>(), "Set log level: finest, fine, trace, none(default)")
     ("output,o", value<string>(), "Create estimate value report directed to <file>")
+    ("timing", "Print the time spent in each process, observation, derived quantity, initialisation phase and report")
     ("single-step", "Single step the model each year with new estimable values")
     ("tabular", "Print reports in Tabular mode")
     ("unittest", "Run the unit tests for CASAL2")
@@ -113,6 +117,8 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
     options.no_std_report_ = true;
   if (parameters.count("output"))
     options.output_ = parameters["output"].as<string>();
+  if (parameters.count("timing"))
+    options.timing_ = true;
   if (parameters.count("single-step"))
     options.single_step_model_ = true;
   if (parameters.count("tabular"))
@@ -123,6 +129,8 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
     options.create_mpd_file_ = false;
   if (parameters.count("skip-estimation"))
     options.skip_estimation_ = true;
+  if (parameters.count("threads"))
+    options.threads_ = parameters["threads"].as<unsigned>();
 
   /**
    * Determine what run mode we should be in. If we're
@@ -175,9 +183,14 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
 
   if (parameters.count("run"))
     options.run_mode_ = RunMode::kBasic;
-  else if (parameters.count("estimate"))
+  else if (parameters.count("estimate")) {
     options.run_mode_ = RunMode::kEstimation;
-  else if (parameters.count("mcmc")) {
+    if (parameters.count("starts")) {
+      options.estimation_starts_ = parameters["starts"].as<unsigned>();
+      if (options.estimation_starts_ == 0)
+        LOG_ERROR() << "The number of estimation starts must be at least one";
+    }
+  } else if (parameters.count("mcmc")) {
     options.run_mode_ = RunMode::kMCMC;
     if (parameters.count("resume")) {
       if (!parameters.count("objective-file") || !parameters.count("sample-file")) {
@@ -189,6 +202,16 @@ void CommandLineParser::Parse(int argc, char* argv[], RunParameters& options) {
       options.mcmc_sample_file_    = parameters["sample-file"].as<string>();
       options.resume_mcmc_chain_   = true;
     }
+
+    if (parameters.count("chains")) {
+      options.mcmc_chains_ = parameters["chains"].as<unsigned>();
+      if (options.mcmc_chains_ == 0)
+        LOG_ERROR() << "The number of MCMC chains must be at least one";
+      if (options.mcmc_chains_ > 1 && options.resume_mcmc_chain_)
+        LOG_ERROR() << "Resuming an MCMC chain is not supported when running multiple chains";
+      if (options.mcmc_chains_ > 1 && !options.create_mpd_file_)
+        LOG_ERROR() << "Running multiple MCMC chains requires the mpd.out file, it cannot be used with --no-mpd";
+    }
   } else if (parameters.count("profiling"))
     options.run_mode_ = RunMode::kProfiling;
   else if (parameters.count("simulation")) {
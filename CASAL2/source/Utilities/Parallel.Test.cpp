@@ -0,0 +1,43 @@
+/**
+ * @file Parallel.Test.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+#ifdef TESTMODE
+
+// headers
+#include "Parallel.h"
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+// namespaces
+namespace niwa {
+namespace utilities {
+
+TEST(Utilities_Parallel, ThreadCount) {
+  EXPECT_EQ(1u, Parallel::ThreadCount(4, 1));
+  EXPECT_EQ(3u, Parallel::ThreadCount(3, 8));
+  EXPECT_EQ(1u, Parallel::ThreadCount(0, 0));
+  EXPECT_GE(Parallel::ThreadCount(0, 8), 1u);
+}
+
+TEST(Utilities_Parallel, For) {
+  std::vector<unsigned> results(100, 0);
+  Parallel::For(100, 4, [&results](unsigned i) { results[i] = i * i; });
+  for (unsigned i = 0; i < 100; ++i)
+    EXPECT_EQ(i * i, results[i]);
+}
+
+TEST(Utilities_Parallel, For_Exception) {
+  EXPECT_THROW(Parallel::For(10, 4, [](unsigned i) { if (i == 5) throw std::string("task 5 failed"); }), std::string);
+}
+
+} /* namespace utilities */
+} /* namespace niwa */
+#endif /* TESTMODE */
@@ -0,0 +1,94 @@
+/**
+ * @file Parallel.cpp
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ */
+
+// Headers
+#include "Parallel.h"
+
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Namespaces
+namespace niwa {
+namespace utilities {
+
+/**
+ * Work out how many threads we should use for a number of tasks
+ *
+ * @param requested The number of threads requested by the user (0 = one per core)
+ * @param tasks The number of tasks we have to run
+ * @return The number of threads to use, between 1 and tasks
+ */
+unsigned Parallel::ThreadCount(unsigned requested, unsigned tasks) {
+  unsigned threads = requested;
+  if (threads == 0)
+    threads = std::thread::hardware_concurrency();
+  if (threads == 0)
+    threads = 1;
+  if (threads > tasks)
+    threads = tasks;
+  return threads == 0 ? 1 : threads;
+}
+
+/**
+ * Run task(i) for each i in [0, tasks) using up to threads threads.
+ * When only one thread is needed the tasks are run on the calling thread.
+ *
+ * If a task throws (e.g. LOG_ERROR in unit tests) the remaining tasks are
+ * skipped and the first exception is re-thrown on the calling thread
+ * once all of the threads have finished.
+ *
+ * @param tasks The number of tasks to run
+ * @param threads The maximum number of threads to use
+ * @param task The work to do for each task index
+ */
+void Parallel::For(unsigned tasks, unsigned threads, const std::function<void(unsigned)>& task) {
+  threads = ThreadCount(threads, tasks);
+  if (threads <= 1) {
+    for (unsigned i = 0; i < tasks; ++i)
+      task(i);
+    return;
+  }
+
+  std::atomic<unsigned> next_task(0);
+  std::exception_ptr    exception;
+  std::mutex            exception_lock;
+
+  auto worker = [&]() {
+    while (true) {
+      unsigned i = next_task++;
+      if (i >= tasks)
+        break;
+
+      try {
+        task(i);
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(exception_lock);
+        if (!exception)
+          exception = std::current_exception();
+        next_task = tasks;
+      }
+    }
+  };
+
+  std::vector<std::thread> pool;
+  for (unsigned i = 0; i < threads; ++i)
+    pool.emplace_back(worker);
+  for (auto& thread : pool)
+    thread.join();
+
+  if (exception)
+    std::rethrow_exception(exception);
+}
+
+} /* namespace utilities */
+} /* namespace niwa */
@@ -0,0 +1,37 @@
+/**
+ * @file Parallel.h
+ * @author  Scott Rasmussen (scott.rasmussen@zaita.com)
+ * @date 18/10/2026
+ * @section LICENSE
+ *
+ * Copyright NIWA Science 2026 - www.niwa.co.nz
+ *
+ * @section DESCRIPTION
+ *
+ * Helpers for running independent pieces of work (e.g. MCMC chains)
+ * across a small pool of threads. Each task is given its index and
+ * tasks are handed out in order, so the work a task does must only
+ * depend on its index and not on which thread runs it.
+ */
+#ifndef UTILITIES_PARALLEL_H_
+#define UTILITIES_PARALLEL_H_
+
+// Headers
+#include <functional>
+
+// Namespaces
+namespace niwa {
+namespace utilities {
+
+/**
+ * Class definition
+ */
+class Parallel {
+public:
+  static unsigned             ThreadCount(unsigned requested, unsigned tasks);
+  static void                 For(unsigned tasks, unsigned threads, const std::function<void(unsigned)>& task);
+};
+
+} /* namespace utilities */
+} /* namespace niwa */
+#endif /* UTILITIES_PARALLEL_H_ */
@@ -16,11 +16,12 @@ namespace utilities {
 
 using std::cout;
 using std::endl;
+using std::vector;
 
 
 TEST(RandomNumberGenerator, Reset) {
 
-  RandomNumberGenerator& rng = RandomNumberGenerator::Instance();
+  RandomNumberGenerator rng;
 
   rng.Reset(2468);
   EXPECT_DOUBLE_EQ(0.45965513936243951, rng.uniform());
@@ -107,6 +108,37 @@ TEST(RandomNumberGenerator, Reset) {
   EXPECT_DOUBLE_EQ(0.70000371866995148,  rng.chi_square(2.0));
 }
 
+TEST(RandomNumberGenerator, Streams) {
+  RandomNumberGenerator master;
+  RandomNumberGenerator stream_one;
+  RandomNumberGenerator stream_two;
+
+  // stream 0 is the master stream
+  master.Reset(2468, 0);
+  EXPECT_DOUBLE_EQ(0.45965513936243951, master.uniform());
+
+  // every stream is reproducible and independent of the order the streams are used in
+  stream_two.Reset(2468, 2);
+  stream_one.Reset(2468, 1);
+  vector<double> first  = { stream_one.uniform(), stream_one.uniform(), stream_one.uniform() };
+  vector<double> second = { stream_two.uniform(), stream_two.uniform(), stream_two.uniform() };
+
+  master.Split(1);
+  EXPECT_EQ(2468u, master.seed());
+  EXPECT_EQ(1u, master.stream());
+  for (unsigned i = 0; i < first.size(); ++i)
+    EXPECT_DOUBLE_EQ(first[i], master.uniform());
+
+  master.Split(2);
+  for (unsigned i = 0; i < second.size(); ++i)
+    EXPECT_DOUBLE_EQ(second[i], master.uniform());
+
+  for (unsigned i = 0; i < first.size(); ++i) {
+    EXPECT_NE(first[i], second[i]);
+    EXPECT_NE(0.45965513936243951, first[i]);
+  }
+}
+
 
 } /* namespace utilities */
 } /* namespace niwa */
@@ -13,8 +13,6 @@
 // Headers
 #include "RandomNumberGenerator.h"
 
-#include "Model/Model.h"
-
 // Namespaces
 namespace niwa {
 namespace utilities {
@@ -32,19 +30,27 @@ RandomNumberGenerator::~RandomNumberGenerator() {
 }
 
 /**
- * Singleton instance method
- * @return reference to singleton object
- */
-RandomNumberGenerator& RandomNumberGenerator::Instance() {
-  static RandomNumberGenerator instance;
-  return instance;
-}
-
-/**
+ * Reset the generator to the start of a stream.
  *
+ * Stream 0 is seeded directly from the seed. Other streams are
+ * seeded through a seed sequence built from the seed and the stream
+ * number so neighbouring streams are not correlated with each other
+ * or with the master stream.
+ *
+ * @param new_seed The master seed
+ * @param stream The stream number to start
  */
-void RandomNumberGenerator::Reset(unsigned new_seed) {
-  generator_.seed(new_seed);
+void RandomNumberGenerator::Reset(unsigned new_seed, unsigned stream) {
+  seed_   = new_seed;
+  stream_ = stream;
+
+  if (stream == 0) {
+    generator_.seed(new_seed);
+    return;
+  }
+
+  boost::random::seed_seq sequence = { new_seed, stream };
+  generator_.seed(sequence);
 }
 
 /**
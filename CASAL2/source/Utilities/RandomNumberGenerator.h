@@ -12,6 +12,14 @@
  * This class is responsible for providing us with random
  * numbers generated in a variety of different ways
  *
+ * Each model owns its own generator (see Model::random_number_generator())
+ * so models running on different threads never share a stream. A
+ * generator can be split in to numbered streams from the master seed.
+ * Stream 0 is the master stream and is seeded exactly as it has always
+ * been so existing runs reproduce. Every other stream is seeded from the
+ * pair (seed, stream) so the values a stream produces only depend on its
+ * number and not on the thread or order it is run in.
+ *
  * $Date: 2008-03-04 16:33:32 +1300 (Tue, 04 Mar 2008) $
  */
 #ifndef UTILITIES_RANDOMNUMBERGENERATOR_H_
@@ -31,9 +39,11 @@ namespace utilities {
  */
 class RandomNumberGenerator {
 public:
-  static RandomNumberGenerator& Instance();
+  // Methods
+  RandomNumberGenerator();
   virtual                       ~RandomNumberGenerator();
-  void                          Reset(unsigned new_seed = 12345u);
+  void                          Reset(unsigned new_seed = 12345u, unsigned stream = 0u);
+  void                          Split(unsigned stream) { Reset(seed_, stream); }
 
   // Accessors
   double                        uniform(double min = 0.0, double max = 1.0);
@@ -42,13 +52,14 @@ public:
   double                        binomial(double p, double n);
   double                        chi_square(unsigned df);
   double                        gamma(double shape);
+  unsigned                      seed() const { return seed_; }
+  unsigned                      stream() const { return stream_; }
 
 private:
-  // Methods
-  RandomNumberGenerator();
-
   // Members
   boost::mt19937                generator_;
+  unsigned                      seed_ = 5489u;
+  unsigned                      stream_ = 0u;
 };
 
 } /* namespace utilities */
@@ -43,10 +43,15 @@ struct RunParameters {
   bool          no_std_report_ = false;
   string        log_level_ = "warning";
   string        output_ = "";
+  bool          timing_ = false;
   bool          single_step_model_ = false;
   bool          tabular_reports_ = false;
   unsigned      simulation_candidates_ = 1u;
   unsigned      projection_candidates_ = 1u;
+  unsigned      mcmc_chains_ = 1u;
+  unsigned      estimation_starts_ = 1u;
+  unsigned      threads_ = 0u;
+  bool          keep_mcmc_chain_ = false;
 
   bool          override_random_number_seed_ = false;
   unsigned      override_rng_seed_value_ = 123u;
@@ -134,7 +134,7 @@ int main(int argc, char * argv[]) {
 
       // override any config file values from our command line
       model.global_configuration().ParseOptions(&model);
-      utilities::RandomNumberGenerator::Instance().Reset(model.global_configuration().random_seed());
+      model.random_number_generator().Reset(model.global_configuration().random_seed());
 
       // Thread off the reports
       reports::Manager* report_manager = model.managers().report();